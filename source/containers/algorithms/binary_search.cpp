@@ -9,11 +9,14 @@ module;
 
 export module containers.algorithms.binary_search;
 
+import containers.algorithms.advance;
 import containers.algorithms.partition;
 import containers.begin_end;
+import containers.iter_difference_t;
 import containers.range;
 import containers.subrange;
 
+import bounded;
 import std_module;
 
 namespace containers {
@@ -38,6 +41,34 @@ struct upper_bound_t {
 };
 export constexpr auto upper_bound = upper_bound_t();
 
+// Returns the same element as `lower_bound`, but searches forward from the
+// beginning of `sorted` with steps that double in size, so an answer `d`
+// elements in costs O(log(d)) comparisons. This is faster than `lower_bound`
+// for a sequence of increasing keys, where each search starts from the
+// previous answer. `sorted` must be sized.
+struct gallop_lower_bound_t {
+	static constexpr auto operator()(range auto && sorted, auto const & value, auto cmp) {
+		auto first = containers::begin(sorted);
+		auto const last = containers::end(sorted);
+		std::size_t step = 1;
+		while (true) {
+			if (step >= static_cast<std::size_t>(last - first)) {
+				return lower_bound(subrange(first, last), value, cmp);
+			}
+			auto const probe = first + ::bounded::assume_in_range<iter_difference_t<decltype(first)>>(step);
+			if (!cmp(*probe, value)) {
+				return lower_bound(subrange(first, probe), value, cmp);
+			}
+			first = ::containers::next(probe);
+			step *= 2;
+		}
+	}
+	static constexpr auto operator()(range auto && sorted, auto const & value) {
+		return operator()(OPERATORS_FORWARD(sorted), value, std::less());
+	}
+};
+export constexpr auto gallop_lower_bound = gallop_lower_bound_t();
+
 // TODO: This can be implemented more efficiently
 struct equal_range_t {
 	static constexpr auto operator()(range auto && sorted, auto const & value, auto cmp) {
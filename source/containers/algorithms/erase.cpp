@@ -87,6 +87,9 @@ constexpr auto erase_to_end(Container & container, iterator_t<Container const &>
 	}
 }
 
+// Calls `predicate` exactly once for each element, in order, so the predicate
+// may be stateful. Containers that cannot erase in constant time are compacted
+// in a single stable pass. Returns the number of elements erased.
 export template<erasable Container>
 constexpr auto erase_if(Container & container, auto predicate) -> count_type<Container> {
 	auto result = count_type<Container>(0_bi);
@@ -102,7 +105,9 @@ constexpr auto erase_if(Container & container, auto predicate) -> count_type<Con
 	} else {
 		auto const first = containers::begin(container);
 		auto const last = containers::end(container);
-		auto new_last = ::containers::find_if(first, last, predicate);
+		// `find_if` takes its predicate by value, so it has to call this one
+		// rather than a copy
+		auto new_last = ::containers::find_if(first, last, [&](auto && element) { return predicate(element); });
 		if (new_last == last) {
 			return result;
 		}
@@ -111,9 +116,9 @@ constexpr auto erase_if(Container & container, auto predicate) -> count_type<Con
 				// TODO: Relocate?
 				*new_last = std::move(*it);
 				++new_last;
-				++result;
 			}
 		}
+		result = ::bounded::assume_in_range<count_type<Container>>(last - new_last);
 		containers::erase_to_end(container, new_last);
 	}
 	return result;
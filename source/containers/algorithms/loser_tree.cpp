@@ -0,0 +1,139 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A tournament tree that stores the loser of each match in the internal nodes.
+// Selecting the next winner after the previous winner's source advances
+// requires one comparison per level of the tree, which makes this the
+// building block for merging many sorted sources at once.
+
+export module containers.algorithms.loser_tree;
+
+import containers.dynamic_array;
+import containers.index_type;
+import containers.maximum_array_size;
+import containers.repeat_n;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+using loser_tree_nodes = dynamic_array<std::size_t>;
+
+constexpr auto node_at(auto & values, std::size_t const index) -> auto & {
+	return values[::bounded::assume_in_range<index_type<loser_tree_nodes>>(index)];
+}
+
+constexpr auto make_loser_tree_nodes(std::size_t const size) -> loser_tree_nodes {
+	return loser_tree_nodes(repeat_n(::bounded::assume_in_range<array_size_type<std::size_t>>(size), std::size_t(0)));
+}
+
+// Sources are identified by their index. `less(lhs, rhs)` compares the current
+// front of source `lhs` with the current front of source `rhs`, and must order
+// exhausted sources after all others. Ties are won by the lower index, so a
+// merge built on this is stable. If there are no sources, `winner()` is 0 and
+// does not identify a source.
+export struct loser_tree {
+	constexpr loser_tree(std::size_t const size, auto const & less):
+		m_size(size),
+		m_leaves(std::bit_ceil(size)),
+		m_losers(make_loser_tree_nodes(m_leaves))
+	{
+		// Node `n` has children `2 * n` and `2 * n + 1`. The leaves are nodes
+		// `[m_leaves, 2 * m_leaves)`.
+		auto winners = make_loser_tree_nodes(2 * m_leaves);
+		for (std::size_t leaf = 0; leaf != m_leaves; ++leaf) {
+			node_at(winners, m_leaves + leaf) = leaf;
+		}
+		for (auto node = m_leaves - 1; node != 0; --node) {
+			auto const left = node_at(winners, 2 * node);
+			auto const right = node_at(winners, 2 * node + 1);
+			auto const right_wins = lower(right, left, less);
+			node_at(winners, node) = right_wins ? right : left;
+			node_at(m_losers, node) = right_wins ? left : right;
+		}
+		m_winner = node_at(winners, 1);
+	}
+
+	constexpr auto size() const -> std::size_t {
+		return m_size;
+	}
+	// The index of the source with the smallest front
+	constexpr auto winner() const -> std::size_t {
+		return m_winner;
+	}
+
+	// Call this after the front of `winner()` changes
+	constexpr auto replay(auto const & less) -> void {
+		auto current = m_winner;
+		for (auto position = m_leaves + current; position != 1; position /= 2) {
+			auto & loser = node_at(m_losers, position / 2);
+			// `current` came up from the left subtree exactly when it has the
+			// lower index, which decides ties.
+			auto const loser_wins = position % 2 == 0 ?
+				lower(loser, current, less) :
+				!lower(current, loser, less);
+			if (loser_wins) {
+				std::swap(loser, current);
+			}
+		}
+		m_winner = current;
+	}
+
+private:
+	// Leaves past `m_size` are padding that lose to everything, and `less` is
+	// never called with them.
+	constexpr auto lower(std::size_t const lhs, std::size_t const rhs, auto const & less) const -> bool {
+		return lhs < m_size and (rhs >= m_size or less(lhs, rhs));
+	}
+
+	std::size_t m_size;
+	std::size_t m_leaves;
+	loser_tree_nodes m_losers;
+	std::size_t m_winner = 0;
+};
+
+} // namespace containers
+
+static_assert([] {
+	constexpr auto sources = std::array{
+		std::array{1, 4, 7, 100},
+		std::array{2, 2, 9, 100},
+		std::array{0, 5, 6, 100},
+	};
+	auto positions = std::array<std::size_t, 3>();
+	auto const less = [&](std::size_t const lhs, std::size_t const rhs) {
+		return sources[lhs][positions[lhs]] < sources[rhs][positions[rhs]];
+	};
+	auto tree = containers::loser_tree(sources.size(), less);
+	auto result = std::array<int, 9>();
+	for (auto & value : result) {
+		auto const winner = tree.winner();
+		value = sources[winner][positions[winner]];
+		++positions[winner];
+		tree.replay(less);
+	}
+	return result == std::array{0, 1, 2, 2, 4, 5, 6, 7, 9};
+}());
+
+static_assert([] {
+	// Ties go to the lowest index
+	auto const less = [](std::size_t, std::size_t) { return false; };
+	auto const tree = containers::loser_tree(5, less);
+	return tree.winner() == 0;
+}());
+
+static_assert([] {
+	auto const less = [](std::size_t, std::size_t) { return false; };
+	auto const tree = containers::loser_tree(1, less);
+	return tree.winner() == 0 and tree.size() == 1;
+}());
+
+static_assert([] {
+	auto const less = [](std::size_t, std::size_t) -> bool { std::unreachable(); };
+	auto tree = containers::loser_tree(0, less);
+	tree.replay(less);
+	return tree.size() == 0;
+}());
@@ -0,0 +1,173 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <operators/forward.hpp>
+
+export module containers.algorithms.merge_k;
+
+import containers.algorithms.advance;
+import containers.algorithms.loser_tree;
+import containers.begin_end;
+export import containers.common_iterator_functions;
+import containers.forward_range;
+import containers.front;
+import containers.index_type;
+import containers.is_empty;
+import containers.iterator_t;
+import containers.push_back;
+import containers.range;
+import containers.range_reference_t;
+import containers.sentinel_t;
+import containers.size;
+import containers.subrange;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+// The unconsumed part of one of the sorted ranges
+template<typename Ranges>
+using merge_cursor = subrange<
+	iterator_t<range_reference_t<Ranges> &>,
+	sentinel_t<range_reference_t<Ranges> &>
+>;
+
+template<typename Ranges>
+constexpr auto make_merge_cursors(Ranges && ranges) -> vector<merge_cursor<Ranges>> {
+	auto cursors = vector<merge_cursor<Ranges>>();
+	for (auto && range : ranges) {
+		::containers::push_back(cursors, merge_cursor<Ranges>(containers::begin(range), containers::end(range)));
+	}
+	return cursors;
+}
+
+template<typename Cursor, typename Compare>
+struct merged_view_iterator {
+	using difference_type = std::ptrdiff_t;
+
+	constexpr merged_view_iterator(vector<Cursor> cursors, Compare compare):
+		m_cursors(std::move(cursors)),
+		m_compare(std::move(compare)),
+		m_tree(static_cast<std::size_t>(containers::size(m_cursors)), cursor_less())
+	{
+	}
+
+	constexpr auto operator*() const -> decltype(auto) {
+		return containers::front(cursor(m_tree.winner()));
+	}
+	friend constexpr auto operator+(merged_view_iterator lhs, bounded::constant_t<1>) -> merged_view_iterator {
+		auto & winner = lhs.cursor(lhs.m_tree.winner());
+		winner = Cursor(containers::next(containers::begin(winner)), containers::end(winner));
+		lhs.m_tree.replay(lhs.cursor_less());
+		return lhs;
+	}
+
+	friend constexpr auto operator==(merged_view_iterator const & lhs, std::default_sentinel_t) -> bool {
+		return containers::is_empty(lhs.m_cursors) or containers::is_empty(lhs.cursor(lhs.m_tree.winner()));
+	}
+
+private:
+	constexpr auto cursor(std::size_t const index) const -> Cursor const & {
+		return m_cursors[::bounded::assume_in_range<index_type<vector<Cursor>>>(index)];
+	}
+	constexpr auto cursor(std::size_t const index) -> Cursor & {
+		return m_cursors[::bounded::assume_in_range<index_type<vector<Cursor>>>(index)];
+	}
+	constexpr auto cursor_less() const {
+		return [this](std::size_t const lhs_index, std::size_t const rhs_index) -> bool {
+			auto const & lhs = cursor(lhs_index);
+			auto const & rhs = cursor(rhs_index);
+			return
+				!containers::is_empty(lhs) and
+				(containers::is_empty(rhs) or m_compare(containers::front(lhs), containers::front(rhs)));
+		};
+	}
+
+	vector<Cursor> m_cursors;
+	[[no_unique_address]] Compare m_compare;
+	loser_tree m_tree;
+};
+
+// Lazily merges a range of sorted forward ranges. Equivalent elements are
+// produced in the order of the ranges that contain them. Producing each
+// element costs O(log(k)) comparisons for k ranges.
+export template<range Ranges, typename Compare = std::less<>>
+struct merged_view {
+	static_assert(forward_range<range_reference_t<Ranges>>);
+	constexpr explicit merged_view(Ranges && ranges, Compare compare = Compare()):
+		m_ranges(OPERATORS_FORWARD(ranges)),
+		m_compare(std::move(compare))
+	{
+	}
+	constexpr auto begin() const & {
+		return merged_view_iterator<merge_cursor<Ranges const &>, Compare>(
+			::containers::make_merge_cursors(m_ranges),
+			m_compare
+		);
+	}
+	constexpr auto begin() & {
+		return merged_view_iterator<merge_cursor<Ranges &>, Compare>(
+			::containers::make_merge_cursors(m_ranges),
+			m_compare
+		);
+	}
+	static constexpr auto end() {
+		return std::default_sentinel;
+	}
+private:
+	[[no_unique_address]] Ranges m_ranges;
+	[[no_unique_address]] Compare m_compare;
+};
+
+template<typename Ranges>
+merged_view(Ranges &&) -> merged_view<Ranges>;
+
+template<typename Ranges, typename Compare>
+merged_view(Ranges &&, Compare) -> merged_view<Ranges, Compare>;
+
+// Writes the merge of a range of sorted forward ranges to `output`, and
+// returns the end of the output
+struct merge_k_t {
+	static constexpr auto operator()(range auto && ranges, auto output, auto compare) {
+		for (auto && value : merged_view(ranges, std::move(compare))) {
+			*output = OPERATORS_FORWARD(value);
+			++output;
+		}
+		return output;
+	}
+	static constexpr auto operator()(range auto && ranges, auto output) {
+		return operator()(ranges, std::move(output), std::less());
+	}
+};
+export constexpr auto merge_k = merge_k_t();
+
+// Like `merge_k`, but writes only the first of each group of equivalent
+// elements
+struct unique_merge_k_t {
+	static constexpr auto operator()(range auto && ranges, auto output, auto compare) {
+		auto const view = merged_view(ranges, compare);
+		auto it = view.begin();
+		while (it != view.end()) {
+			decltype(auto) value = *it;
+			*output = value;
+			++output;
+			++it;
+			while (it != view.end() and !compare(value, *it)) {
+				++it;
+			}
+		}
+		return output;
+	}
+	static constexpr auto operator()(range auto && ranges, auto output) {
+		return operator()(ranges, std::move(output), std::less());
+	}
+};
+export constexpr auto unique_merge_k = unique_merge_k_t();
+
+} // namespace containers
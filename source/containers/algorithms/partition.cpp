@@ -9,6 +9,8 @@ module;
 
 export module containers.algorithms.partition;
 
+import containers.algorithms.sort.sort_statistics;
+
 import containers.algorithms.advance;
 import containers.algorithms.find;
 import containers.begin_end;
@@ -124,6 +126,7 @@ struct iterator_partition_t {
 				return first;
 			}
 			std::ranges::swap(*first, *last_less_than);
+			::containers::record_sort_statistic(&sort_statistics::swaps);
 			last = last_less_than;
 			if (first == middle) {
 				middle = last_less_than;
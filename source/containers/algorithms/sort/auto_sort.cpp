@@ -0,0 +1,164 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.algorithms.sort.auto_sort;
+
+import containers.algorithms.sort.counting_sort;
+import containers.algorithms.sort.double_buffered_ska_sort;
+import containers.algorithms.sort.is_sorted;
+import containers.algorithms.sort.ska_sort;
+import containers.algorithms.sort.sort;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.algorithms.copy;
+import containers.algorithms.erase;
+import containers.algorithms.move_range;
+import containers.algorithms.unique;
+import containers.begin_end;
+import containers.dynamic_array;
+import containers.extract_key_to_less;
+import containers.maximum_array_size;
+import containers.range;
+import containers.range_reference_t;
+import containers.range_size_t;
+import containers.range_value_t;
+import containers.repeat_n;
+import containers.size;
+import containers.subrange;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Below this size a comparison sort is faster than any radix sort. This is the
+// same threshold `ska_sort` uses for its subranges.
+constexpr auto comparison_sort_threshold = 128_bi;
+
+// Elements this small are cheap enough to copy into a temporary buffer
+constexpr auto max_buffered_element_size = 16_bi;
+
+// Without a buffer from the caller, `double_buffered_ska_sort` has to allocate
+// one. Below this size the allocation costs more than the in-place sort it
+// replaces, and callers like `flat_map` insert small batches often.
+constexpr auto min_allocated_buffer_size = 4096_bi;
+
+template<typename Function, typename Range>
+concept comparison_function_for = std::predicate<
+	Function const &,
+	range_reference_t<Range &>,
+	range_reference_t<Range &>
+>;
+
+template<typename Range, typename ExtractKey>
+using sort_key_t = std::decay_t<decltype(bounded::declval<ExtractKey const &>()(bounded::declval<range_reference_t<Range &>>()))>;
+
+// `double_buffered_ska_sort` does a fixed number of passes over the data for
+// these keys, regardless of the distribution.
+template<typename Key>
+concept fixed_pass_key = std::same_as<Key, bool> or bounded::unsigned_builtin<Key>;
+
+template<typename T>
+concept affordable_buffer_element =
+	std::is_trivially_copyable_v<T> and
+	std::default_initializable<T> and
+	sizeof(T) <= max_buffered_element_size;
+
+struct no_buffer {
+};
+
+constexpr auto double_buffered_sort_in_place(range auto & to_sort, range auto && buffer, auto const & extract_key) -> void {
+	auto scratch = subrange(containers::begin(buffer), containers::size(to_sort));
+	auto const sorted_into_buffer = ::containers::double_buffered_ska_sort(to_sort, scratch, extract_key);
+	if (sorted_into_buffer) {
+		::containers::copy(::containers::move_range(scratch), containers::begin(to_sort));
+	}
+}
+
+template<typename Range, typename ExtractKey>
+constexpr auto radix_sort(Range & to_sort, ExtractKey const & extract_key, auto && buffer) -> void {
+	using value_type = range_value_t<Range>;
+	using key_type = sort_key_t<Range, ExtractKey>;
+	if constexpr (std::same_as<ExtractKey, to_radix_sort_key_t> and counting_sortable<value_type>) {
+		::containers::counting_sort(to_sort);
+	} else if constexpr (!fixed_pass_key<key_type>) {
+		::containers::ska_sort(to_sort, extract_key);
+	} else if constexpr (!std::same_as<std::decay_t<decltype(buffer)>, no_buffer>) {
+		if (containers::size(buffer) >= containers::size(to_sort)) {
+			::containers::double_buffered_sort_in_place(to_sort, buffer, extract_key);
+		} else {
+			::containers::ska_sort(to_sort, extract_key);
+		}
+	} else if constexpr (affordable_buffer_element<value_type>) {
+		if (containers::size(to_sort) >= min_allocated_buffer_size) {
+			auto temp = dynamic_array<value_type>(repeat_default_n<value_type>(
+				::bounded::assume_in_range<array_size_type<value_type>>(containers::size(to_sort))
+			));
+			::containers::double_buffered_sort_in_place(to_sort, temp, extract_key);
+		} else {
+			::containers::ska_sort(to_sort, extract_key);
+		}
+	} else {
+		::containers::ska_sort(to_sort, extract_key);
+	}
+}
+
+template<typename Range>
+constexpr auto auto_sort_impl(Range & to_sort, auto const & function, auto && buffer) -> void {
+	if constexpr (comparison_function_for<decltype(function), Range>) {
+		::containers::new_sort(to_sort, function);
+	} else if constexpr (numeric_traits::max_value<range_size_t<Range>> <= comparison_sort_threshold) {
+		::containers::new_sort(to_sort, extract_key_to_less(function));
+	} else {
+		if (containers::size(to_sort) <= comparison_sort_threshold) {
+			::containers::new_sort(to_sort, extract_key_to_less(function));
+		} else if (!::containers::is_sorted(to_sort, extract_key_to_less(function))) {
+			// Checking for existing order stops at the first element out of
+			// order, so it costs almost nothing for data that needs sorting.
+			::containers::radix_sort(to_sort, function, buffer);
+		}
+	}
+}
+
+// Chooses the sorting algorithm based on the element type, the key type, and
+// the size of the range. `function` can be either a comparison function or a
+// function that returns a key suitable for radix sorting. The optional
+// `buffer` must have the same value type as `to_sort`. It is used only if it
+// has at least as many elements as `to_sort`, and its contents are
+// unspecified afterward.
+struct auto_sort_t {
+	static constexpr auto operator()(range auto && to_sort, auto const & function, range auto && buffer) -> void {
+		::containers::auto_sort_impl(to_sort, function, buffer);
+	}
+	static constexpr auto operator()(range auto && to_sort, auto const & function) -> void {
+		::containers::auto_sort_impl(to_sort, function, no_buffer());
+	}
+	static constexpr auto operator()(range auto && to_sort) -> void {
+		operator()(to_sort, to_radix_sort_key);
+	}
+};
+export constexpr auto auto_sort = auto_sort_t();
+
+struct unique_auto_sort_t {
+	static constexpr auto operator()(range auto & to_sort, auto const & extract_key) -> void {
+		::containers::auto_sort(to_sort, extract_key);
+		auto const equal = [&](auto const & lhs, auto const & rhs) {
+			return extract_key(lhs) == extract_key(rhs);
+		};
+		::containers::erase_to_end(
+			to_sort,
+			::containers::unique(containers::begin(to_sort), containers::end(to_sort), equal)
+		);
+	}
+	static constexpr auto operator()(range auto & to_sort) -> void {
+		operator()(to_sort, to_radix_sort_key);
+	}
+};
+export constexpr auto unique_auto_sort = unique_auto_sort_t();
+
+} // namespace containers
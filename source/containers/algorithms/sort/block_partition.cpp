@@ -0,0 +1,151 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the partitioning step of BlockQuicksort, as
+// described in "BlockQuicksort: How Branch Mispredictions don't affect
+// Quicksort" by Stefan Edelkamp and Armin Weiss. Rather than branching on the
+// result of each comparison, we record the offsets of misplaced elements in a
+// small buffer and then swap them in bulk.
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.algorithms.sort.block_partition;
+
+import containers.algorithms.sort.sort_statistics;
+
+import containers.algorithms.partition;
+
+import containers.array;
+import containers.begin_end;
+import containers.iter_difference_t;
+import containers.random_access_iterator;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Each offset fits in a byte, so each of the two offset buffers fills one
+// cache line
+constexpr auto block_size = 64_bi;
+
+using block_offsets = std::array<std::uint8_t, static_cast<std::size_t>(block_size)>;
+
+// Has the same behavior as `iterator_partition`, but the value of `*middle` is
+// copied rather than tracked as elements move, so this should be used only
+// when the element type is `cheaply_sortable`.
+struct block_partition_t {
+	template<random_access_iterator Iterator>
+	static constexpr auto operator()(Iterator first, Iterator const middle, Iterator last, auto const compare) -> Iterator {
+		BOUNDED_ASSERT(first == last or middle != last);
+		if (first == last) {
+			return first;
+		}
+		auto const pivot = *middle;
+		auto const predicate = [&](auto const & value) -> bool {
+			return compare(value, pivot);
+		};
+		using difference_type = iter_difference_t<Iterator>;
+		if constexpr (numeric_traits::max_value<difference_type> > 2_bi * block_size) {
+			auto const from_first = [&](std::uint8_t const offset) -> decltype(auto) {
+				return *(first + ::bounded::assume_in_range<difference_type>(offset));
+			};
+			auto const from_last = [&](std::uint8_t const offset) -> decltype(auto) {
+				return *(last - ::bounded::assume_in_range<difference_type>(offset + 1));
+			};
+			auto offsets_first = block_offsets();
+			auto offsets_last = block_offsets();
+			std::size_t start_first = 0;
+			std::size_t start_last = 0;
+			std::size_t count_first = 0;
+			std::size_t count_last = 0;
+			while (last - first > 2_bi * block_size) {
+				// Record which elements of the next block on each side are on
+				// the wrong side of the pivot. There is no branch that depends
+				// on the result of the comparison.
+				if (count_first == 0) {
+					start_first = 0;
+					for (std::uint8_t offset = 0; offset != offsets_first.size(); ++offset) {
+						offsets_first[count_first] = offset;
+						count_first += static_cast<std::size_t>(!predicate(from_first(offset)));
+					}
+				}
+				if (count_last == 0) {
+					start_last = 0;
+					for (std::uint8_t offset = 0; offset != offsets_last.size(); ++offset) {
+						offsets_last[count_last] = offset;
+						count_last += static_cast<std::size_t>(predicate(from_last(offset)));
+					}
+				}
+				auto const count = std::min(count_first, count_last);
+				for (std::size_t n = 0; n != count; ++n) {
+					std::ranges::swap(
+						from_first(offsets_first[start_first + n]),
+						from_last(offsets_last[start_last + n])
+					);
+				}
+				::containers::record_sort_statistic(&sort_statistics::swaps, count);
+				count_first -= count;
+				count_last -= count;
+				start_first += count;
+				start_last += count;
+				if (count_first == 0) {
+					first += block_size;
+				}
+				if (count_last == 0) {
+					last -= block_size;
+				}
+			}
+			// Everything before `first` satisfies the predicate and everything
+			// at or after `last` does not. Any partially processed block is
+			// still within [first, last).
+		}
+		return ::containers::partition(first, last, predicate);
+	}
+};
+export constexpr auto block_partition = block_partition_t();
+
+} // namespace containers
+
+static_assert([] {
+	// Large enough to use several blocks from each side
+	constexpr auto size = 1000_bi;
+	auto values = containers::array<int, size>();
+	auto state = 1U;
+	for (auto & value : values) {
+		state = state * 1'103'515'245U + 12'345U;
+		value = static_cast<int>((state >> 16U) % 1000U);
+	}
+	auto const first = containers::begin(values);
+	auto const middle = first + 500_bi;
+	auto const pivot = *middle;
+	auto const it = containers::block_partition(first, middle, containers::end(values), std::less());
+	auto const expected_middle = containers::partition_point(values, [=](int const value) { return value < pivot; });
+	return
+		containers::is_partitioned(values, [=](int const value) { return value < pivot; }) and
+		it == expected_middle;
+}());
+
+static_assert([] {
+	auto values = containers::array<int, 300_bi>();
+	for (auto & value : values) {
+		value = 5;
+	}
+	auto const first = containers::begin(values);
+	auto const it = containers::block_partition(first, first + 150_bi, containers::end(values), std::less());
+	return it == first;
+}());
+
+static_assert([] {
+	auto values = containers::array({3, 1, 2});
+	auto const first = containers::begin(values);
+	auto const it = containers::block_partition(first, first + 2_bi, containers::end(values), std::less());
+	return it == first + 1_bi and *first == 1;
+}());
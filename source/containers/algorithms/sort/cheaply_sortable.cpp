@@ -5,6 +5,8 @@
 
 export module containers.algorithms.sort.cheaply_sortable;
 
+import containers.algorithms.sort.sort_statistics;
+
 import bounded;
 import std_module;
 
@@ -20,6 +22,9 @@ export template<typename T, typename Compare>
 concept cheaply_sortable =
 	std::is_trivially_copyable_v<T> and
 	sizeof(T) <= 64_bi and
-	(std::same_as<Compare, std::less<>> or std::same_as<Compare, std::greater<>>);
+	(
+		std::same_as<unwrap_counted_compare<Compare>, std::less<>> or
+		std::same_as<unwrap_counted_compare<Compare>, std::greater<>>
+	);
 
 } // namespace containers
\ No newline at end of file
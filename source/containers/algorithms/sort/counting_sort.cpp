@@ -0,0 +1,87 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.algorithms.sort.counting_sort;
+
+import containers.algorithms.sort.sort_statistics;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.array;
+import containers.begin_end;
+import containers.range;
+import containers.range_value_t;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Values for which equal radix sort keys imply equal values, so the sorted
+// range can be regenerated from the count of each key.
+template<typename T>
+concept key_determines_value =
+	std::is_trivially_copyable_v<T> and
+	std::default_initializable<T> and
+	(
+		std::same_as<T, bool> or
+		std::same_as<T, std::byte> or
+		bounded::builtin_integer<T> or
+		bounded::bounded_integer<T> or
+		std::is_enum_v<T>
+	);
+
+export template<typename T>
+concept counting_sortable =
+	key_determines_value<T> and
+	sizeof(decltype(to_radix_sort_key(bounded::declval<T const &>()))) == 1;
+
+// Sorts in two linear passes without moving any elements
+struct counting_sort_t {
+	template<range Range> requires counting_sortable<range_value_t<Range>>
+	static constexpr auto operator()(Range && to_sort) -> void {
+		using value_type = range_value_t<Range>;
+		auto counts = std::array<std::size_t, 256>();
+		auto values = std::array<value_type, 256>();
+		for (auto const & value : to_sort) {
+			auto const key = static_cast<std::size_t>(to_radix_sort_key(value));
+			++counts[key];
+			values[key] = value;
+		}
+		::containers::record_radix_pass(0U);
+		auto it = containers::begin(to_sort);
+		for (std::size_t key = 0; key != counts.size(); ++key) {
+			for (std::size_t n = 0; n != counts[key]; ++n) {
+				*it = values[key];
+				++it;
+			}
+		}
+	}
+};
+export constexpr auto counting_sort = counting_sort_t();
+
+} // namespace containers
+
+static_assert([] {
+	auto values = containers::array<std::int8_t, 6_bi>{5, -3, 0, 5, -128, 2};
+	containers::counting_sort(values);
+	return values == containers::array<std::int8_t, 6_bi>{-128, -3, 0, 2, 5, 5};
+}());
+
+static_assert([] {
+	auto values = containers::array({true, false, true, false});
+	containers::counting_sort(values);
+	return values == containers::array({false, false, true, true});
+}());
+
+static_assert([] {
+	auto values = containers::array({bounded::integer<1, 10>(7_bi), bounded::integer<1, 10>(1_bi), bounded::integer<1, 10>(10_bi)});
+	containers::counting_sort(values);
+	return values == containers::array({bounded::integer<1, 10>(1_bi), bounded::integer<1, 10>(7_bi), bounded::integer<1, 10>(10_bi)});
+}());
+
+static_assert(!containers::counting_sortable<std::uint16_t>);
+static_assert(!containers::counting_sortable<float>);
@@ -11,6 +11,7 @@ module;
 
 export module containers.algorithms.sort.double_buffered_ska_sort;
 
+import containers.algorithms.sort.sort_statistics;
 import containers.algorithms.sort.to_radix_sort_key;
 
 import containers.algorithms.advance;
@@ -84,6 +85,7 @@ constexpr auto bool_sort_copy(auto & source, auto & output, auto const & extract
 	// trailing true values, then only do this algorithm on the middle section.
 	// I'm not sure if the increased code size is worth the benefit of iterating
 	// over those values only once.
+	::containers::record_sort_statistic(&sort_statistics::moves, static_cast<std::size_t>(containers::size(source)));
 	auto false_position = containers::begin(output);
 	auto true_position = containers::next(
 		false_position,
@@ -120,6 +122,9 @@ constexpr auto double_buffered_numeric_sort(Source & source, Buffer & buffer, Ex
 	}
 	for (auto index_it = containers::begin(index_range); index_it != containers::end(index_range); ) {
 		auto sort_segment_copy = [&](auto & current, auto & next) {
+			// `*index_it` counts from the least significant byte
+			::containers::record_radix_pass(static_cast<std::size_t>(size - 1_bi - *index_it));
+			::containers::record_sort_statistic(&sort_statistics::moves, static_cast<std::size_t>(containers::size(current)));
 			for (auto && value : current) {
 				auto const key = (bounded::integer(extract_key(value)) >> (*index_it * 8_bi)) % 256_bi;
 				next[::bounded::assume_in_range<containers::index_type<Buffer>>(counts[*index_it][key]++)] = std::move(value);
@@ -0,0 +1,276 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Sorts files of fixed-size records that do not fit in memory. The input is
+// split into runs that are sorted in memory and written to temporary files,
+// and then the runs are merged with a loser tree. All file access is in large
+// sequential blocks.
+
+export module containers.algorithms.sort.external_sort;
+
+import containers.algorithms.sort.auto_sort;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.algorithms.loser_tree;
+import containers.clear;
+import containers.extract_key_to_less;
+import containers.index_type;
+import containers.is_empty;
+import containers.maximum_array_size;
+import containers.push_back;
+import containers.range;
+import containers.size;
+import containers.span;
+import containers.uninitialized_dynamic_array;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+export struct external_sort_options {
+	// Maximum number of bytes used to hold records at any one time. A merge
+	// needs a block for each of at least two runs and one for the output, so
+	// this must be at least three I/O blocks.
+	std::size_t memory_budget = 256 * 1024 * 1024;
+	// Number of bytes in each read from or write to a file. This is rounded
+	// down to a whole number of records, but is at least one record.
+	std::size_t io_block_size = 1024 * 1024;
+};
+
+template<typename T>
+using record_buffer = uninitialized_dynamic_array<T, array_size_type<T>>;
+
+template<typename T>
+auto make_record_buffer(std::size_t const records) -> record_buffer<T> {
+	return record_buffer<T>(::bounded::check_in_range<array_size_type<T>>(records));
+}
+
+template<typename T>
+auto records_per(std::size_t const bytes) -> std::size_t {
+	return std::max(bytes / sizeof(T), std::size_t(1));
+}
+
+// Returns fewer than `count` records only at the end of the file. Reads bytes
+// rather than records so that a partial record at the end of the file is an
+// error rather than silently dropped.
+template<typename T>
+auto read_records(std::FILE * const file, T * const buffer, std::size_t const count) -> std::size_t {
+	auto const bytes = std::fread(buffer, 1, count * sizeof(T), file);
+	if (bytes != count * sizeof(T) and std::ferror(file)) {
+		throw std::runtime_error("Unable to read records for external_sort");
+	}
+	if (bytes % sizeof(T) != 0) {
+		throw std::runtime_error("external_sort input ends with a partial record");
+	}
+	return bytes / sizeof(T);
+}
+
+template<typename T>
+auto write_records(std::FILE * const file, T const * const buffer, std::size_t const count) -> void {
+	if (std::fwrite(buffer, sizeof(T), count, file) != count) {
+		throw std::runtime_error("Unable to write records for external_sort");
+	}
+}
+
+struct file_closer {
+	static auto operator()(std::FILE * const file) -> void {
+		std::fclose(file);
+	}
+};
+using temporary_file = std::unique_ptr<std::FILE, file_closer>;
+
+// Removed automatically when closed
+auto make_temporary_file() -> temporary_file {
+	auto file = temporary_file(std::tmpfile());
+	if (!file) {
+		throw std::runtime_error("Unable to create a temporary file for external_sort");
+	}
+	return file;
+}
+
+auto rewind_for_reading(std::FILE * const file) -> void {
+	if (std::fflush(file) != 0 or std::fseek(file, 0, SEEK_SET) != 0) {
+		throw std::runtime_error("Unable to rewind a temporary file for external_sort");
+	}
+}
+
+template<typename T>
+struct run_reader {
+	run_reader(std::FILE * const file, std::size_t const buffer_records):
+		m_file(file),
+		m_buffer(make_record_buffer<T>(buffer_records))
+	{
+		refill();
+	}
+
+	auto is_empty() const -> bool {
+		return m_position == m_count;
+	}
+	auto front() const -> T const & {
+		return m_buffer.data()[m_position];
+	}
+	auto pop_front() -> void {
+		++m_position;
+		if (m_position == m_count) {
+			refill();
+		}
+	}
+
+private:
+	auto refill() -> void {
+		m_position = 0;
+		m_count = ::containers::read_records(m_file, m_buffer.data(), static_cast<std::size_t>(m_buffer.capacity()));
+	}
+
+	std::FILE * m_file;
+	record_buffer<T> m_buffer;
+	std::size_t m_position = 0;
+	std::size_t m_count = 0;
+};
+
+template<typename T>
+struct run_writer {
+	run_writer(std::FILE * const file, std::size_t const buffer_records):
+		m_file(file),
+		m_buffer(make_record_buffer<T>(buffer_records))
+	{
+	}
+
+	auto push_back(T const & value) -> void {
+		if (m_size == static_cast<std::size_t>(m_buffer.capacity())) {
+			flush();
+		}
+		std::construct_at(m_buffer.data() + m_size, value);
+		++m_size;
+	}
+	auto flush() -> void {
+		::containers::write_records(m_file, m_buffer.data(), m_size);
+		m_size = 0;
+	}
+
+private:
+	std::FILE * m_file;
+	record_buffer<T> m_buffer;
+	std::size_t m_size = 0;
+};
+
+template<typename T>
+auto merge_runs(range auto const & runs, std::FILE * const output, auto const & less, std::size_t const buffer_records) -> void {
+	auto readers = containers::vector<run_reader<T>>();
+	for (auto const & run : runs) {
+		::containers::push_back(readers, run_reader<T>(run.get(), buffer_records));
+	}
+	auto const reader = [&](std::size_t const index) -> run_reader<T> & {
+		return readers[::bounded::assume_in_range<index_type<decltype(readers)>>(index)];
+	};
+	auto const compare_fronts = [&](std::size_t const lhs, std::size_t const rhs) {
+		auto const & lhs_reader = reader(lhs);
+		auto const & rhs_reader = reader(rhs);
+		return
+			!lhs_reader.is_empty() and
+			(rhs_reader.is_empty() or less(lhs_reader.front(), rhs_reader.front()));
+	};
+	auto tree = loser_tree(static_cast<std::size_t>(containers::size(readers)), compare_fronts);
+	auto writer = run_writer<T>(output, buffer_records);
+	while (true) {
+		auto & next = reader(tree.winner());
+		if (next.is_empty()) {
+			break;
+		}
+		writer.push_back(next.front());
+		next.pop_front();
+		tree.replay(compare_fronts);
+	}
+	writer.flush();
+}
+
+template<typename T>
+auto merge_to_temporary_file(range auto const & runs, auto const & less, std::size_t const buffer_records) -> temporary_file {
+	auto file = ::containers::make_temporary_file();
+	::containers::merge_runs<T>(runs, file.get(), less, buffer_records);
+	::containers::rewind_for_reading(file.get());
+	return file;
+}
+
+// Sorts the records of `input` from its current position to the end and writes
+// them to `output`. `T` must be trivially copyable, and records are read and
+// written as their object representation. `extract_key` is anything accepted
+// by `auto_sort`, except a comparison function. Throws `std::invalid_argument`
+// if `options.memory_budget` is less than three I/O blocks, and
+// `std::runtime_error` if any file operation fails or the input ends with a
+// partial record.
+template<typename T>
+struct external_sort_t {
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	static auto operator()(std::FILE * const input, std::FILE * const output, auto const & extract_key, external_sort_options const options = external_sort_options()) -> void {
+		auto const less = extract_key_to_less(extract_key);
+		auto const block_records = records_per<T>(options.io_block_size);
+		if (options.memory_budget / (block_records * sizeof(T)) < 3U) {
+			throw std::invalid_argument("external_sort needs a memory budget of at least three I/O blocks");
+		}
+
+		// Half of the budget holds the run, and the other half is scratch
+		// space for the radix sort.
+		auto const run_records = records_per<T>(options.memory_budget / 2);
+		auto runs = containers::vector<temporary_file>();
+		{
+			auto records = make_record_buffer<T>(run_records);
+			auto scratch = make_record_buffer<T>(run_records);
+			while (true) {
+				auto const count = ::containers::read_records(input, records.data(), run_records);
+				if (count == 0) {
+					break;
+				}
+				auto const size = ::bounded::assume_in_range<array_size_type<T>>(count);
+				::containers::auto_sort(span(records.data(), size), extract_key, span(scratch.data(), size));
+				if (containers::is_empty(runs) and count != run_records) {
+					// Everything fit in memory
+					::containers::write_records(output, records.data(), count);
+					return;
+				}
+				auto run = ::containers::make_temporary_file();
+				::containers::write_records(run.get(), records.data(), count);
+				::containers::rewind_for_reading(run.get());
+				::containers::push_back(runs, std::move(run));
+			}
+		}
+
+		// Each run being merged and the output get a buffer of one I/O block.
+		// If there are too many runs to merge in one pass within the budget,
+		// merge groups of runs into longer runs first.
+		auto const max_runs_per_merge = options.memory_budget / (block_records * sizeof(T)) - 1U;
+		while (static_cast<std::size_t>(containers::size(runs)) > max_runs_per_merge) {
+			auto merged = containers::vector<temporary_file>();
+			auto group = containers::vector<temporary_file>();
+			auto merge_group = [&] {
+				::containers::push_back(merged, ::containers::merge_to_temporary_file<T>(group, less, block_records));
+				::containers::clear(group);
+			};
+			for (auto & run : runs) {
+				::containers::push_back(group, std::move(run));
+				if (static_cast<std::size_t>(containers::size(group)) == max_runs_per_merge) {
+					merge_group();
+				}
+			}
+			if (!containers::is_empty(group)) {
+				merge_group();
+			}
+			runs = std::move(merged);
+		}
+		if (!containers::is_empty(runs)) {
+			::containers::merge_runs<T>(runs, output, less, block_records);
+		}
+	}
+	static auto operator()(std::FILE * const input, std::FILE * const output) -> void {
+		operator()(input, output, to_radix_sort_key);
+	}
+};
+export template<typename T>
+constexpr auto external_sort = external_sort_t<T>();
+
+} // namespace containers
@@ -18,6 +18,7 @@ export module containers.algorithms.sort.inplace_radix_sort;
 
 import containers.algorithms.sort.common_prefix;
 import containers.algorithms.sort.sort;
+import containers.algorithms.sort.sort_statistics;
 import containers.algorithms.sort.to_radix_sort_key;
 
 import containers.algorithms.advance;
@@ -207,10 +208,15 @@ private:
 		if (number_of_bytes == offset) {
 			next_sort(to_sort, extract_key, sort_data);
 		} else if (containers::size(to_sort) <= bounded::constant<std_sort_threshold>) {
+			::containers::record_sort_statistic(&sort_statistics::std_sort_fallbacks);
 			containers::sort(to_sort, extract_key_to_less(extract_key));
 		} else if (containers::size(to_sort) < bounded::constant<american_flag_sort_threshold>) {
+			::containers::record_sort_statistic(&sort_statistics::american_flag_sorts);
+			::containers::record_radix_pass(offset);
 			american_flag_sort(to_sort, extract_key, next_sort, sort_data, offset);
 		} else {
+			::containers::record_sort_statistic(&sort_statistics::ska_byte_sorts);
+			::containers::record_radix_pass(offset);
 			ska_byte_sort(to_sort, extract_key, next_sort, sort_data, offset);
 		}
 	}
@@ -249,6 +255,7 @@ private:
 					auto const partition_offset = ::bounded::assume_in_range<containers::index_type<View>>(block->offset++);
 					using std::swap;
 					swap(*it, to_sort[partition_offset]);
+					::containers::record_sort_statistic(&sort_statistics::swaps);
 				}
 			}
 		}
@@ -289,6 +296,7 @@ private:
 					if (it != other) {
 						using std::swap;
 						swap(*it, *(first + partition_offset));
+						::containers::record_sort_statistic(&sort_statistics::swaps);
 					}
 				}
 				return begin_offset != end_offset;
@@ -412,6 +420,7 @@ private:
 		++offset.current_index;
 		--offset.recursion_limit;
 		if (offset.recursion_limit == 0) {
+			::containers::record_sort_statistic(&sort_statistics::std_sort_fallbacks);
 			containers::sort(to_sort, extract_key_to_less(extract_key));
 		} else {
 			sort(to_sort, extract_key, offset);
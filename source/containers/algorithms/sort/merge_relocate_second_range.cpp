@@ -24,10 +24,10 @@ using namespace bounded::literal;
 
 namespace containers {
 
-// `r1` is assumed to not need any relocation for any elements at the beginning
-// that are before any elements in `r2`. Essentially, overall data layout is
-// "contents of r1", then enough space for the contents of r2, with `r2` itself
-// being in a separate region of memory.
+// The overall data layout is "contents of r1", then enough space for the
+// contents of r2, with `r2` itself being in a separate region of memory.
+// Elements at the beginning of `r1` that are before every element of `r2` are
+// not moved.
 export constexpr auto merge_relocate_second_range(range auto && r1, range auto && r2, iterator auto out_last, auto const compare) -> void {
 	BOUNDED_ASSERT(!containers::is_empty(r2));
 	auto const first2 = containers::begin(r2);
@@ -48,6 +48,7 @@ export constexpr auto merge_relocate_second_range(range auto && r1, range auto &
 		if (compare(*last2, *last1)) {
 			bounded::relocate_at(*out_last, *last1);
 			if (first1 == last1) {
+				++last2;
 				relocate_remainder_of_r2();
 				break;
 			}
@@ -62,6 +63,50 @@ export constexpr auto merge_relocate_second_range(range auto && r1, range auto &
 	}
 }
 
+// Like `merge_relocate_second_range`, but each range must be unique, and any
+// element of `r2` that is equivalent to an element of `r1` is destroyed rather
+// than relocated. `out_last` must be the end of `r1` plus the number of
+// elements of `r2` that are not destroyed.
+export constexpr auto unique_merge_relocate_second_range(range auto && r1, range auto && r2, iterator auto out_last, auto const compare) -> void {
+	BOUNDED_ASSERT(!containers::is_empty(r2));
+	auto const first2 = containers::begin(r2);
+	auto last2 = containers::end(r2);
+	auto const first1 = containers::begin(r1);
+	auto last1 = containers::end(r1);
+	auto relocate_remainder_of_r2 = [&] {
+		::containers::uninitialized_relocate_no_overlap(subrange(first2, last2), first1);
+	};
+	if (first1 == last1) {
+		relocate_remainder_of_r2();
+		return;
+	}
+	--last1;
+	--last2;
+	while (true) {
+		if (compare(*last2, *last1)) {
+			--out_last;
+			bounded::relocate_at(*out_last, *last1);
+			if (first1 == last1) {
+				++last2;
+				relocate_remainder_of_r2();
+				break;
+			}
+			--last1;
+		} else {
+			if (compare(*last1, *last2)) {
+				--out_last;
+				bounded::relocate_at(*out_last, *last2);
+			} else {
+				bounded::destroy(*last2);
+			}
+			if (first2 == last2) {
+				break;
+			}
+			--last2;
+		}
+	}
+}
+
 } // namespace containers
 
 static_assert([] {
@@ -123,3 +168,51 @@ static_assert([] {
 	);
 	return buffer == containers::array({0, 1, 2, 3, 4});
 }());
+
+static_assert([] {
+	auto buffer = containers::array({5, 0, 0});
+	auto other = containers::array({1, 2});
+	::containers::merge_relocate_second_range(
+		containers::subrange(containers::begin(buffer), 1_bi),
+		other,
+		containers::end(buffer),
+		std::less()
+	);
+	return buffer == containers::array({1, 2, 5});
+}());
+
+static_assert([] {
+	auto buffer = containers::array({1, 3, 5, 7, 0, 0});
+	auto other = containers::array({2, 3, 7, 8});
+	::containers::unique_merge_relocate_second_range(
+		containers::subrange(containers::begin(buffer), 4_bi),
+		other,
+		containers::end(buffer),
+		std::less()
+	);
+	return buffer == containers::array({1, 2, 3, 5, 7, 8});
+}());
+
+static_assert([] {
+	auto buffer = containers::array({4, 5, 0, 0});
+	auto other = containers::array({1, 2, 5});
+	::containers::unique_merge_relocate_second_range(
+		containers::subrange(containers::begin(buffer), 2_bi),
+		other,
+		containers::end(buffer),
+		std::less()
+	);
+	return buffer == containers::array({1, 2, 4, 5});
+}());
+
+static_assert([] {
+	auto buffer = containers::array({1, 2});
+	auto other = containers::array({1, 2});
+	::containers::unique_merge_relocate_second_range(
+		containers::subrange(containers::begin(buffer), 2_bi),
+		other,
+		containers::end(buffer),
+		std::less()
+	);
+	return buffer == containers::array({1, 2});
+}());
@@ -9,8 +9,11 @@ module;
 
 export module containers.algorithms.sort.sort;
 
+import containers.algorithms.sort.block_partition;
+import containers.algorithms.sort.cheaply_sortable;
 import containers.algorithms.sort.is_sorted;
 import containers.algorithms.sort.small_size_optimized_sort;
+import containers.algorithms.sort.sort_statistics;
 import containers.algorithms.sort.sort_exactly_3;
 import containers.algorithms.sort.sort_exactly_5;
 
@@ -34,6 +37,7 @@ using namespace bounded::literal;
 namespace containers {
 
 constexpr auto heap_sort(range auto && r, auto const compare) -> void {
+	::containers::record_sort_statistic(&sort_statistics::heap_sorts);
 	auto const first = containers::begin(r);
 	auto const last = containers::end(r);
 	std::make_heap(maybe_legacy_iterator(first), maybe_legacy_iterator(last), compare);
@@ -65,7 +69,11 @@ constexpr auto introsort_impl(Depth const depth) {
 		} else {
 			median_of(first, median, before_last);
 		}
-		median = iterator_partition(first, median, last, compare);
+		if constexpr (cheaply_sortable<iter_value_t<decltype(first)>, std::remove_const_t<decltype(compare)>>) {
+			median = block_partition(first, median, last, compare);
+		} else {
+			median = iterator_partition(first, median, last, compare);
+		}
 		auto next_depth = Depth(bounded::assume_in_range<Depth>(depth - 1_bi));
 		::containers::introsort(subrange(first, median), compare, next_depth);
 		::containers::introsort(subrange(median, last), compare, next_depth);
@@ -84,7 +92,7 @@ struct new_sort_t {
 			auto const depth = 2_bi * bounded::log(size, 2_bi);
 			introsort(
 				to_sort,
-				compare,
+				::containers::count_comparisons(compare),
 				bounded::integer<0, bounded::builtin_max_value<decltype(depth)>>(depth)
 			);
 		}
@@ -101,7 +109,7 @@ struct sort_t {
 		std::sort(
 			maybe_legacy_iterator(containers::begin(to_sort)),
 			maybe_legacy_iterator(containers::end(to_sort)),
-			cmp
+			::containers::count_comparisons(cmp)
 		);
 	}
 	static constexpr auto operator()(range auto & to_sort) -> void {
@@ -0,0 +1,129 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Counters for tuning the sorting algorithms. These are compiled out unless
+// `CONTAINERS_SORT_STATISTICS` is defined (see the `CONTAINERS_SORT_STATISTICS`
+// CMake option). Counters are per-thread and are never recorded during
+// constant evaluation.
+
+export module containers.algorithms.sort.sort_statistics;
+
+import std_module;
+
+namespace containers {
+
+export constexpr auto sort_statistics_enabled =
+#if defined CONTAINERS_SORT_STATISTICS
+	true;
+#else
+	false;
+#endif
+
+export struct sort_statistics {
+	// Calls to the comparison function
+	std::size_t comparisons = 0;
+	// Elements moved to a different location, other than as part of a swap.
+	// Only the sorts that distribute into a buffer (`double_buffered_ska_sort`)
+	// move elements this way. The in-place sorts count `swaps` instead.
+	std::size_t moves = 0;
+	std::size_t swaps = 0;
+	// Number of distribution passes, indexed by the position of the byte that
+	// was being sorted on, counting from the most significant byte of the key.
+	// Keys with more bytes than this are counted in the last element.
+	std::array<std::size_t, 16> radix_passes = {};
+	// Which algorithm ran for each (sub)range
+	std::size_t std_sort_fallbacks = 0;
+	std::size_t american_flag_sorts = 0;
+	std::size_t ska_byte_sorts = 0;
+	std::size_t heap_sorts = 0;
+
+	friend auto operator==(sort_statistics const &, sort_statistics const &) -> bool = default;
+};
+
+export auto current_sort_statistics() -> sort_statistics & {
+	thread_local auto statistics = sort_statistics();
+	return statistics;
+}
+
+// Returns the statistics accumulated since the previous call
+export auto reset_sort_statistics() -> sort_statistics {
+	return std::exchange(current_sort_statistics(), sort_statistics());
+}
+
+// Calls `function(name, value)` for each counter, for use with reporting tools
+export auto for_each_sort_statistic(sort_statistics const & statistics, auto && function) -> void {
+	function("comparisons", statistics.comparisons);
+	function("moves", statistics.moves);
+	function("swaps", statistics.swaps);
+	for (std::size_t byte = 0; byte != statistics.radix_passes.size(); ++byte) {
+		if (statistics.radix_passes[byte] != 0) {
+			function("radix_passes_byte_" + std::to_string(byte), statistics.radix_passes[byte]);
+		}
+	}
+	function("std_sort_fallbacks", statistics.std_sort_fallbacks);
+	function("american_flag_sorts", statistics.american_flag_sorts);
+	function("ska_byte_sorts", statistics.ska_byte_sorts);
+	function("heap_sorts", statistics.heap_sorts);
+}
+
+export constexpr auto record_sort_statistic(std::size_t sort_statistics::* const counter, std::size_t const count = 1) -> void {
+	if constexpr (sort_statistics_enabled) {
+		if !consteval {
+			current_sort_statistics().*counter += count;
+		}
+	}
+}
+
+// `byte` counts from the most significant byte of the key
+export constexpr auto record_radix_pass(std::size_t const byte) -> void {
+	if constexpr (sort_statistics_enabled) {
+		if !consteval {
+			auto & passes = current_sort_statistics().radix_passes;
+			++passes[std::min(byte, passes.size() - 1U)];
+		}
+	}
+}
+
+// Wraps a comparison function so that calls to it are counted. Sorting
+// algorithms that choose their strategy based on the comparison function
+// should look through this with `unwrap_counted_compare`.
+template<typename Compare>
+struct counted_compare {
+	[[no_unique_address]] Compare compare;
+
+	constexpr auto operator()(auto const & lhs, auto const & rhs) const -> decltype(auto) {
+		::containers::record_sort_statistic(&sort_statistics::comparisons);
+		return compare(lhs, rhs);
+	}
+};
+
+template<typename Compare>
+struct unwrap_counted_compare_impl {
+	using type = Compare;
+};
+template<typename Compare>
+struct unwrap_counted_compare_impl<counted_compare<Compare>> {
+	using type = Compare;
+};
+
+export template<typename Compare>
+using unwrap_counted_compare = typename unwrap_counted_compare_impl<std::remove_const_t<Compare>>::type;
+
+export constexpr auto count_comparisons(auto compare) {
+	if constexpr (sort_statistics_enabled) {
+		return counted_compare<decltype(compare)>{std::move(compare)};
+	} else {
+		return compare;
+	}
+}
+
+} // namespace containers
+
+static_assert([] {
+	// Never recorded at compile time
+	::containers::record_sort_statistic(&containers::sort_statistics::swaps);
+	::containers::record_radix_pass(100U);
+	return ::containers::count_comparisons(std::less())(1, 2);
+}());
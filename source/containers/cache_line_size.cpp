@@ -0,0 +1,16 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.cache_line_size;
+
+import std_module;
+
+namespace containers {
+
+// Not std::hardware_destructive_interference_size, which can change between
+// compiler flags and so is not safe to use in an interface
+export constexpr auto cache_line_size = std::size_t(64);
+
+} // namespace containers
@@ -0,0 +1,140 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.constant_map;
+
+import containers.algorithms.sort.sort;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.array;
+import containers.begin_end;
+import containers.c_array;
+import containers.extract_key_to_less;
+import containers.index_type;
+import containers.map_value_type;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+// The sizes of the halves that a branchless binary search over `size`
+// elements steps over, in order
+template<std::size_t size>
+constexpr auto search_step_count = [] {
+	std::size_t count = 0;
+	for (auto remaining = size; remaining > 1; remaining -= remaining / 2) {
+		++count;
+	}
+	return count;
+}();
+
+template<std::size_t size>
+constexpr auto search_steps = [] {
+	auto result = std::array<std::size_t, search_step_count<size>>();
+	auto remaining = size;
+	for (auto & step : result) {
+		step = remaining / 2;
+		remaining -= step;
+	}
+	return result;
+}();
+
+// A map whose contents are fixed when it is constructed, meant to be declared
+// `constexpr` so that the sorting happens during constant evaluation. Lookup
+// is a binary search over a separate array of just the keys. The number of
+// steps depends only on the size of the map, so the search is fully unrolled
+// and has no data-dependent branches. Duplicate keys are an error.
+export template<typename Key, typename Mapped, std::size_t size_, typename ExtractKey = to_radix_sort_key_t>
+struct constant_map {
+	static_assert(size_ > 0);
+
+	using key_type = Key;
+	using mapped_type = Mapped;
+	using value_type = map_value_type<Key, Mapped>;
+
+	constexpr explicit constant_map(c_array<value_type, size_> && source, ExtractKey extract_key = ExtractKey()):
+		constant_map(
+			sort_unique(source, extract_key),
+			extract_key,
+			std::make_index_sequence<size_>()
+		)
+	{
+	}
+
+	constexpr auto compare() const {
+		return ::containers::extract_key_to_less(m_extract_key);
+	}
+
+	constexpr auto begin() const {
+		return ::containers::begin(m_values);
+	}
+	static constexpr auto size() {
+		return bounded::constant<size_>;
+	}
+
+	constexpr auto find(Key const & key) const {
+		return begin() + ::bounded::assume_in_range<bounded::integer<0, bounded::normalize<size_>>>(index_of(key));
+	}
+
+private:
+	template<std::size_t... indexes>
+	constexpr constant_map(c_array<value_type, size_> & sorted, ExtractKey extract_key, std::index_sequence<indexes...>):
+		m_keys{{sorted[indexes].key...}},
+		m_values{{std::move(sorted[indexes])...}},
+		m_extract_key(std::move(extract_key))
+	{
+	}
+
+	static constexpr auto sort_unique(c_array<value_type, size_> & source, ExtractKey const & extract_key) -> c_array<value_type, size_> & {
+		auto const key_less = ::containers::extract_key_to_less(extract_key);
+		::containers::sort(source, [&](value_type const & lhs, value_type const & rhs) {
+			return key_less(lhs.key, rhs.key);
+		});
+		for (std::size_t index = 1; index < size_; ++index) {
+			BOUNDED_ASSERT(key_less(source[index - 1].key, source[index].key));
+		}
+		return source;
+	}
+
+	constexpr auto key_at(std::size_t const index) const -> Key const & {
+		return m_keys[::bounded::assume_in_range<index_type<decltype(m_keys)>>(index)];
+	}
+
+	// Returns the size of the map if `key` is not in the map
+	constexpr auto index_of(Key const & key) const -> std::size_t {
+		auto const less = compare();
+		std::size_t base = 0;
+		[&]<std::size_t... step_indexes>(std::index_sequence<step_indexes...>) {
+			((base = less(key_at(base + search_steps<size_>[step_indexes]), key) ? base + search_steps<size_>[step_indexes] : base), ...);
+		}(std::make_index_sequence<search_step_count<size_>>());
+		base += less(key_at(base), key) ? 1U : 0U;
+		return (base != size_ and !less(key, key_at(base))) ? base : size_;
+	}
+
+	array<Key, bounded::constant<size_>> m_keys;
+	array<value_type, bounded::constant<size_>> m_values;
+	[[no_unique_address]] ExtractKey m_extract_key;
+};
+
+template<typename Key, typename Mapped, std::size_t size>
+constant_map(c_array<map_value_type<Key, Mapped>, size> &&) -> constant_map<Key, Mapped, size>;
+
+template<typename Key, typename Mapped, std::size_t size, typename ExtractKey>
+constant_map(c_array<map_value_type<Key, Mapped>, size> &&, ExtractKey) -> constant_map<Key, Mapped, size, ExtractKey>;
+
+// Deduces the size of the map, so that only the key and mapped types need to
+// be given:
+// `constexpr auto map = make_constant_map<std::string_view, int>({{"a", 1}})`
+export template<typename Key, typename Mapped, std::size_t size>
+constexpr auto make_constant_map(c_array<map_value_type<Key, Mapped>, size> && source) {
+	return constant_map<Key, Mapped, size>(std::move(source));
+}
+
+} // namespace containers
@@ -5,11 +5,15 @@
 
 export module containers;
 
+export import containers.algorithms.sort.auto_sort;
+export import containers.algorithms.sort.counting_sort;
 export import containers.algorithms.sort.double_buffered_ska_sort;
+export import containers.algorithms.sort.external_sort;
 export import containers.algorithms.sort.is_sorted;
 export import containers.algorithms.sort.ska_sort;
 export import containers.algorithms.sort.small_size_optimized_sort;
 export import containers.algorithms.sort.sort;
+export import containers.algorithms.sort.sort_statistics;
 export import containers.algorithms.sort.to_radix_sort_key;
 
 export import containers.algorithms.accumulate;
@@ -39,7 +43,9 @@ export import containers.algorithms.join_with;
 export import containers.algorithms.keyed_binary_search;
 export import containers.algorithms.keyed_erase;
 export import containers.algorithms.keyed_insert;
+export import containers.algorithms.loser_tree;
 export import containers.algorithms.maybe_find;
+export import containers.algorithms.merge_k;
 export import containers.algorithms.minmax_element;
 export import containers.algorithms.mismatch;
 export import containers.algorithms.move_range;
@@ -73,15 +79,20 @@ export import containers.bidirectional_iterator;
 export import containers.bidirectional_range;
 export import containers.bounded_vector;
 export import containers.c_array;
+export import containers.cache_line_size;
 export import containers.can_set_size;
 export import containers.clear;
 export import containers.common_iterator_functions;
+export import containers.constant_map;
 export import containers.contiguous_range;
 export import containers.data;
+export import containers.deque;
 export import containers.dynamic_array;
+export import containers.dynamic_bitset;
 export import containers.emplace_back;
 export import containers.emplace_back_into_capacity;
 export import containers.exponential_force_reserve;
+export import containers.find_all;
 export import containers.flat_map;
 export import containers.forward_iterator;
 export import containers.forward_random_access_iterator;
@@ -110,6 +121,9 @@ export import containers.lookup;
 export import containers.map_tags;
 export import containers.map_value_type;
 export import containers.maximum_array_size;
+export import containers.mpmc_queue;
+export import containers.packed_vector;
+export import containers.poly_vector;
 export import containers.pop_back;
 export import containers.pop_front;
 export import containers.push_back;
@@ -128,12 +142,20 @@ export import containers.reserve_space_for;
 export import containers.resizable_container;
 export import containers.resize;
 export import containers.sbo_vector;
+export import containers.segmented_vector;
 export import containers.sentinel_for;
 export import containers.size;
 export import containers.size_then_use_range;
 export import containers.sized_range;
+export import containers.slot_map;
+export import containers.soa_flat_map;
+export import containers.soa_linear_map;
+export import containers.soa_map_iterator;
+export import containers.soa_vector;
 export import containers.span;
+export import containers.spsc_queue;
 export import containers.stable_vector;
+export import containers.static_ring_buffer;
 export import containers.static_vector;
 export import containers.string;
 export import containers.string_view;
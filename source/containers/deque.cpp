@@ -0,0 +1,260 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+#include <operators/arrow.hpp>
+#include <operators/bracket.hpp>
+#include <operators/forward.hpp>
+
+export module containers.deque;
+
+import containers.algorithms.destroy_range;
+import containers.assign_to_empty;
+import containers.begin_end;
+import containers.c_array;
+export import containers.common_iterator_functions;
+import containers.compare_container;
+import containers.dynamic_array;
+import containers.initializer_range;
+import containers.maximum_array_size;
+import containers.range_value_t;
+import containers.repeat_n;
+import containers.size;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Blocks of about a page, rounded down to a power of two so that finding the
+// block of an element is a shift and a mask
+template<typename T>
+constexpr auto deque_block_size = std::max(std::bit_floor(std::size_t(4096) / sizeof(T)), std::size_t(16));
+
+template<typename T>
+struct deque_iterator {
+private:
+	using value_type = std::remove_const_t<T>;
+	static constexpr auto block_size = deque_block_size<value_type>;
+	static constexpr auto max_difference = bounded::normalize<maximum_array_size<value_type>>;
+public:
+	using difference_type = bounded::integer<bounded::normalize<-max_difference>, max_difference>;
+
+	deque_iterator() = default;
+	constexpr deque_iterator(value_type * const * const blocks, std::size_t const slot):
+		m_blocks(blocks),
+		m_slot(slot)
+	{
+	}
+
+	constexpr operator deque_iterator<T const>() const requires(!std::is_const_v<T>) {
+		return deque_iterator<T const>(m_blocks, m_slot);
+	}
+
+	constexpr auto operator*() const -> T & {
+		return m_blocks[m_slot / block_size][m_slot % block_size];
+	}
+	OPERATORS_ARROW_DEFINITIONS
+
+	friend constexpr auto operator+(deque_iterator const it, difference_type const offset) -> deque_iterator {
+		return deque_iterator(
+			it.m_blocks,
+			static_cast<std::size_t>(static_cast<std::ptrdiff_t>(it.m_slot) + static_cast<std::ptrdiff_t>(offset))
+		);
+	}
+	friend constexpr auto operator-(deque_iterator const lhs, deque_iterator const rhs) -> difference_type {
+		return ::bounded::assume_in_range<difference_type>(
+			static_cast<std::ptrdiff_t>(lhs.m_slot) - static_cast<std::ptrdiff_t>(rhs.m_slot)
+		);
+	}
+	friend constexpr auto operator<=>(deque_iterator const lhs, deque_iterator const rhs) {
+		return lhs.m_slot <=> rhs.m_slot;
+	}
+	friend constexpr auto operator==(deque_iterator const lhs, deque_iterator const rhs) -> bool {
+		return lhs.m_slot == rhs.m_slot;
+	}
+
+private:
+	value_type * const * m_blocks = nullptr;
+	std::size_t m_slot = 0;
+};
+
+// A sequence that can grow and shrink at both ends in O(1) time. The elements
+// are stored in fixed-size blocks, and a map of pointers to the blocks is
+// indexed by position. Adding an element at either end allocates at most one
+// block and never moves any elements, so this costs one allocation per block
+// rather than one per element like a linked list. Blocks are kept after their
+// elements are removed, so a deque used as a queue stops allocating once it
+// reaches its largest size.
+//
+// Adding elements invalidates iterators but not references.
+export template<typename T>
+struct deque : private lexicographical_comparison::base {
+	using size_type = array_size_type<T>;
+	using const_iterator = deque_iterator<T const>;
+	using iterator = deque_iterator<T>;
+
+	constexpr deque() = default;
+
+	constexpr explicit deque(constructor_initializer_range<deque> auto && source) {
+		::containers::assign_to_empty(*this, OPERATORS_FORWARD(source));
+	}
+
+	template<std::size_t source_size>
+	constexpr deque(c_array<T, source_size> && source) {
+		::containers::assign_to_empty(*this, std::move(source));
+	}
+	template<std::same_as<empty_c_array_parameter> Source = empty_c_array_parameter>
+	constexpr deque(Source) {
+	}
+
+	constexpr deque(deque && other) noexcept {
+		swap(*this, other);
+	}
+	constexpr deque(deque const & other) {
+		::containers::assign_to_empty(*this, other);
+	}
+
+	constexpr ~deque() noexcept {
+		clear();
+		for (auto const block : m_blocks) {
+			if (block != nullptr) {
+				std::allocator<T>().deallocate(block, block_size);
+			}
+		}
+	}
+
+	constexpr auto operator=(deque && other) & noexcept -> deque & {
+		swap(*this, other);
+		return *this;
+	}
+	constexpr auto operator=(deque const & other) & -> deque & {
+		if (this != std::addressof(other)) {
+			auto temp = other;
+			swap(*this, temp);
+		}
+		return *this;
+	}
+
+	friend constexpr auto swap(deque & lhs, deque & rhs) noexcept -> void {
+		std::swap(lhs.m_blocks, rhs.m_blocks);
+		std::swap(lhs.m_first, rhs.m_first);
+		std::swap(lhs.m_size, rhs.m_size);
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(m_blocks.data(), m_first);
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(m_blocks.data(), m_first);
+	}
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+	OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS
+
+	constexpr auto lazy_push_back(bounded::construct_function_for<T> auto && constructor) & -> T & {
+		if (end_slot() == block_count() * block_size) {
+			make_room();
+		}
+		auto & element = *storage_for(end_slot());
+		bounded::construct_at(element, OPERATORS_FORWARD(constructor));
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		return element;
+	}
+	constexpr auto lazy_push_front(bounded::construct_function_for<T> auto && constructor) & -> T & {
+		if (m_first == 0) {
+			make_room();
+		}
+		auto & element = *storage_for(m_first - 1U);
+		bounded::construct_at(element, OPERATORS_FORWARD(constructor));
+		--m_first;
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		return element;
+	}
+
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		bounded::destroy(*storage_for(end_slot() - 1U));
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+	}
+	constexpr auto pop_front() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		bounded::destroy(*storage_for(m_first));
+		++m_first;
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+	}
+	// Keeps the allocated blocks
+	constexpr auto clear() & -> void {
+		::containers::destroy_range(*this);
+		m_size = 0_bi;
+	}
+
+private:
+	static constexpr auto block_size = deque_block_size<T>;
+	using block_map = dynamic_array<T *>;
+
+	constexpr auto block_count() const -> std::size_t {
+		return static_cast<std::size_t>(::containers::size(m_blocks));
+	}
+	constexpr auto end_slot() const -> std::size_t {
+		return m_first + static_cast<std::size_t>(m_size);
+	}
+
+	// Allocates the block for `slot` if needed
+	constexpr auto storage_for(std::size_t const slot) -> T * {
+		auto & block = m_blocks.data()[slot / block_size];
+		if (block == nullptr) {
+			block = std::allocator<T>().allocate(block_size);
+		}
+		return block + slot % block_size;
+	}
+
+	// Leaves at least one free block at each end of the map. If the blocks in
+	// use take up less than half of the map, they are rotated to the middle
+	// along with the free blocks, so that a deque that is used as a queue
+	// reuses its blocks. Otherwise, the map doubles in size.
+	constexpr auto make_room() -> void {
+		auto const old_count = block_count();
+		auto const first_block = m_first / block_size;
+		auto const used_blocks = m_size == 0_bi ? std::size_t(0) : (end_slot() - 1U) / block_size - first_block + 1U;
+		auto const blocks = m_blocks.data();
+		if ((used_blocks + 2U) * 2U <= old_count) {
+			auto const new_first_block = (old_count - used_blocks) / 2U;
+			if (new_first_block < first_block) {
+				std::rotate(blocks + new_first_block, blocks + first_block, blocks + first_block + used_blocks);
+			} else {
+				std::rotate(blocks + first_block, blocks + first_block + used_blocks, blocks + new_first_block + used_blocks);
+			}
+			m_first = new_first_block * block_size + m_first % block_size;
+		} else {
+			auto const new_count = std::max(old_count * 2U, std::size_t(4));
+			auto new_blocks = block_map(::containers::repeat_n(
+				::bounded::assume_in_range<array_size_type<T *>>(new_count),
+				static_cast<T *>(nullptr)
+			));
+			auto const offset = (new_count - old_count) / 2U;
+			std::copy(blocks, blocks + old_count, new_blocks.data() + offset);
+			m_blocks = std::move(new_blocks);
+			m_first += offset * block_size;
+		}
+	}
+
+	block_map m_blocks;
+	// The position of the first element, counting from the start of the first
+	// block in the map
+	std::size_t m_first = 0;
+	size_type m_size = 0_bi;
+};
+
+template<typename Range>
+deque(Range &&) -> deque<std::decay_t<range_value_t<Range>>>;
+
+} // namespace containers
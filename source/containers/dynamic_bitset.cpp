@@ -0,0 +1,348 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.dynamic_bitset;
+
+export import containers.common_iterator_functions;
+import containers.maximum_array_size;
+import containers.pop_back;
+import containers.push_back;
+import containers.repeat_n;
+import containers.size;
+import containers.span;
+import containers.subrange;
+import containers.vector;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+using bitset_word = std::uint64_t;
+constexpr auto bitset_word_bits = std::size_t(64);
+
+export using bitset_size_type = bounded::integer<0, bounded::normalize<maximum_array_size<bitset_word> * 64_bi>>;
+
+constexpr auto bitset_word_count(std::size_t const size) -> std::size_t {
+	return (size + bitset_word_bits - 1U) / bitset_word_bits;
+}
+
+constexpr auto bit_mask(std::size_t const index) -> bitset_word {
+	return bitset_word(1) << (index % bitset_word_bits);
+}
+
+// Visits the index of each set bit in order. The lowest set bit of each word is
+// found with `std::countr_zero` and then cleared, so the cost is proportional
+// to the number of set bits plus the number of words, not the number of bits.
+struct set_bit_iterator {
+	using difference_type = bounded::integer<bounded::normalize<-numeric_traits::max_value<bitset_size_type>>, bounded::normalize<numeric_traits::max_value<bitset_size_type>>>;
+
+	set_bit_iterator() = default;
+	constexpr set_bit_iterator(bitset_word const * const words, std::size_t const word_count):
+		m_words(words),
+		m_word_count(word_count),
+		m_current(word_count == 0 ? 0 : words[0])
+	{
+		skip_empty_words();
+	}
+
+	constexpr auto operator*() const -> bitset_size_type {
+		return ::bounded::assume_in_range<bitset_size_type>(
+			m_word_index * bitset_word_bits + static_cast<std::size_t>(std::countr_zero(m_current))
+		);
+	}
+
+	friend constexpr auto operator+(set_bit_iterator it, bounded::constant_t<1>) -> set_bit_iterator {
+		it.m_current &= it.m_current - 1U;
+		it.skip_empty_words();
+		return it;
+	}
+	friend constexpr auto operator==(set_bit_iterator const lhs, set_bit_iterator const rhs) -> bool {
+		return lhs.m_word_index == rhs.m_word_index and lhs.m_current == rhs.m_current;
+	}
+	friend constexpr auto operator==(set_bit_iterator const it, std::default_sentinel_t) -> bool {
+		return it.m_word_index == it.m_word_count;
+	}
+
+private:
+	constexpr auto skip_empty_words() -> void {
+		while (m_current == 0 and m_word_index != m_word_count) {
+			++m_word_index;
+			if (m_word_index != m_word_count) {
+				m_current = m_words[m_word_index];
+			}
+		}
+	}
+
+	bitset_word const * m_words = nullptr;
+	std::size_t m_word_count = 0;
+	std::size_t m_word_index = 0;
+	bitset_word m_current = 0;
+};
+
+// A sequence of bits whose size is set at run time. The bits are stored in
+// 64-bit words, and the operations on whole sets work a word at a time in
+// simple loops that the compiler can vectorize. The unused bits at the end of
+// the last word are always 0, so `count` and the set bits never see them.
+export struct dynamic_bitset {
+	using size_type = bitset_size_type;
+
+	constexpr dynamic_bitset() = default;
+	constexpr explicit dynamic_bitset(size_type const size, bool const value = false):
+		m_words(::containers::repeat_n(
+			::bounded::assume_in_range<array_size_type<bitset_word>>(bitset_word_count(static_cast<std::size_t>(size))),
+			value ? ~bitset_word(0) : bitset_word(0)
+		)),
+		m_size(size)
+	{
+		clear_unused_bits();
+	}
+
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+	// The underlying words. Bit `n` is bit `n % 64` of word `n / 64`.
+	constexpr auto words() const -> span<bitset_word const> {
+		return span<bitset_word const>(m_words.data(), ::containers::size(m_words));
+	}
+
+	constexpr auto operator[](size_type const index) const -> bool {
+		BOUNDED_ASSERT(index < m_size);
+		return (word_for(index) & bit_mask(static_cast<std::size_t>(index))) != 0;
+	}
+	constexpr auto set(size_type const index) & -> void {
+		BOUNDED_ASSERT(index < m_size);
+		word_for(index) |= bit_mask(static_cast<std::size_t>(index));
+	}
+	constexpr auto set(size_type const index, bool const value) & -> void {
+		if (value) {
+			set(index);
+		} else {
+			reset(index);
+		}
+	}
+	constexpr auto reset(size_type const index) & -> void {
+		BOUNDED_ASSERT(index < m_size);
+		word_for(index) &= ~bit_mask(static_cast<std::size_t>(index));
+	}
+	constexpr auto flip(size_type const index) & -> void {
+		BOUNDED_ASSERT(index < m_size);
+		word_for(index) ^= bit_mask(static_cast<std::size_t>(index));
+	}
+
+	constexpr auto set_all() & -> void {
+		for (auto & word : m_words) {
+			word = ~bitset_word(0);
+		}
+		clear_unused_bits();
+	}
+	constexpr auto reset_all() & -> void {
+		for (auto & word : m_words) {
+			word = 0;
+		}
+	}
+	constexpr auto flip_all() & -> void {
+		for (auto & word : m_words) {
+			word = ~word;
+		}
+		clear_unused_bits();
+	}
+
+	constexpr auto push_back(bool const value) & -> void {
+		auto const index = static_cast<std::size_t>(m_size);
+		if (index % bitset_word_bits == 0) {
+			::containers::push_back(m_words, bitset_word(0));
+		}
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		set(::bounded::assume_in_range<size_type>(index), value);
+	}
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		reset(::bounded::assume_in_range<size_type>(m_size - 1_bi));
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+		if (static_cast<std::size_t>(m_size) % bitset_word_bits == 0) {
+			::containers::pop_back(m_words);
+		}
+	}
+	constexpr auto clear() & -> void {
+		m_words = {};
+		m_size = 0_bi;
+	}
+
+	// The number of set bits
+	constexpr auto count() const -> size_type {
+		auto result = std::size_t(0);
+		for (auto const word : m_words) {
+			result += static_cast<std::size_t>(std::popcount(word));
+		}
+		return ::bounded::assume_in_range<size_type>(result);
+	}
+	constexpr auto any() const -> bool {
+		for (auto const word : m_words) {
+			if (word != 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+	constexpr auto none() const -> bool {
+		return !any();
+	}
+
+	// The indexes of the set bits, in increasing order
+	constexpr auto set_bits() const {
+		return containers::subrange(
+			set_bit_iterator(m_words.data(), static_cast<std::size_t>(::containers::size(m_words))),
+			std::default_sentinel
+		);
+	}
+
+	// The sets must be the same size
+	constexpr auto operator&=(dynamic_bitset const & other) & -> dynamic_bitset & {
+		combine(other, [](bitset_word const lhs, bitset_word const rhs) { return lhs & rhs; });
+		return *this;
+	}
+	constexpr auto operator|=(dynamic_bitset const & other) & -> dynamic_bitset & {
+		combine(other, [](bitset_word const lhs, bitset_word const rhs) { return lhs | rhs; });
+		return *this;
+	}
+	constexpr auto operator^=(dynamic_bitset const & other) & -> dynamic_bitset & {
+		combine(other, [](bitset_word const lhs, bitset_word const rhs) { return lhs ^ rhs; });
+		return *this;
+	}
+	// Clears every bit that is set in `other`
+	constexpr auto and_not(dynamic_bitset const & other) & -> dynamic_bitset & {
+		combine(other, [](bitset_word const lhs, bitset_word const rhs) { return lhs & ~rhs; });
+		return *this;
+	}
+
+	friend constexpr auto operator&(dynamic_bitset lhs, dynamic_bitset const & rhs) -> dynamic_bitset {
+		lhs &= rhs;
+		return lhs;
+	}
+	friend constexpr auto operator|(dynamic_bitset lhs, dynamic_bitset const & rhs) -> dynamic_bitset {
+		lhs |= rhs;
+		return lhs;
+	}
+	friend constexpr auto operator^(dynamic_bitset lhs, dynamic_bitset const & rhs) -> dynamic_bitset {
+		lhs ^= rhs;
+		return lhs;
+	}
+
+	friend constexpr auto operator==(dynamic_bitset const & lhs, dynamic_bitset const & rhs) -> bool {
+		return lhs.m_size == rhs.m_size and lhs.m_words == rhs.m_words;
+	}
+
+private:
+	constexpr auto word_for(size_type const index) const -> bitset_word const & {
+		return m_words.data()[static_cast<std::size_t>(index) / bitset_word_bits];
+	}
+	constexpr auto word_for(size_type const index) -> bitset_word & {
+		return m_words.data()[static_cast<std::size_t>(index) / bitset_word_bits];
+	}
+
+	constexpr auto clear_unused_bits() -> void {
+		auto const used = static_cast<std::size_t>(m_size) % bitset_word_bits;
+		if (used != 0) {
+			m_words.data()[static_cast<std::size_t>(::containers::size(m_words)) - 1U] &= (bitset_word(1) << used) - 1U;
+		}
+	}
+
+	constexpr auto combine(dynamic_bitset const & other, auto const function) -> void {
+		BOUNDED_ASSERT(m_size == other.m_size);
+		auto const lhs = m_words.data();
+		auto const rhs = other.m_words.data();
+		auto const count = static_cast<std::size_t>(::containers::size(m_words));
+		for (std::size_t index = 0; index != count; ++index) {
+			lhs[index] = function(lhs[index], rhs[index]);
+		}
+	}
+
+	vector<bitset_word> m_words;
+	size_type m_size = 0_bi;
+};
+
+// Answers `rank` and `select` queries on a bitset in close to constant time.
+// It stores the number of set bits before each block of 512 bits, which adds
+// 1/8 to the size of the bitset. It refers to the bitset and must be rebuilt
+// after the bitset changes.
+export struct bitset_rank_select {
+	using size_type = bitset_size_type;
+
+	constexpr explicit bitset_rank_select(dynamic_bitset const & bits):
+		m_words(bits.words())
+	{
+		auto const word_count = static_cast<std::size_t>(::containers::size(m_words));
+		auto total = std::size_t(0);
+		for (std::size_t index = 0; index != word_count; ++index) {
+			if (index % words_per_block == 0) {
+				::containers::push_back(m_block_ranks, static_cast<std::uint64_t>(total));
+			}
+			total += static_cast<std::size_t>(std::popcount(m_words.data()[index]));
+		}
+		m_count = total;
+	}
+
+	// The number of set bits before `index`
+	constexpr auto rank(size_type const index) const -> size_type {
+		auto const position = static_cast<std::size_t>(index);
+		BOUNDED_ASSERT(position <= static_cast<std::size_t>(::containers::size(m_words)) * bitset_word_bits);
+		auto const word_index = position / bitset_word_bits;
+		auto const block = word_index / words_per_block;
+		auto result = block < static_cast<std::size_t>(::containers::size(m_block_ranks)) ?
+			static_cast<std::size_t>(m_block_ranks.data()[block]) :
+			m_count;
+		for (auto word = block * words_per_block; word < word_index; ++word) {
+			result += static_cast<std::size_t>(std::popcount(m_words.data()[word]));
+		}
+		auto const offset = position % bitset_word_bits;
+		if (offset != 0) {
+			result += static_cast<std::size_t>(std::popcount(m_words.data()[word_index] & ((bitset_word(1) << offset) - 1U)));
+		}
+		return ::bounded::assume_in_range<size_type>(result);
+	}
+
+	// The index of the set bit that has `n` set bits before it. There must be
+	// more than `n` set bits.
+	constexpr auto select(size_type const n) const -> size_type {
+		auto remaining = static_cast<std::size_t>(n);
+		BOUNDED_ASSERT(remaining < m_count);
+		auto const ranks = m_block_ranks.data();
+		auto const block_count = static_cast<std::size_t>(::containers::size(m_block_ranks));
+		auto const block = static_cast<std::size_t>(std::upper_bound(ranks, ranks + block_count, static_cast<std::uint64_t>(remaining)) - ranks) - 1U;
+		remaining -= static_cast<std::size_t>(ranks[block]);
+		auto word_index = block * words_per_block;
+		while (true) {
+			auto word = m_words.data()[word_index];
+			auto const word_count = static_cast<std::size_t>(std::popcount(word));
+			if (remaining < word_count) {
+				for (; remaining != 0; --remaining) {
+					word &= word - 1U;
+				}
+				return ::bounded::assume_in_range<size_type>(
+					word_index * bitset_word_bits + static_cast<std::size_t>(std::countr_zero(word))
+				);
+			}
+			remaining -= word_count;
+			++word_index;
+		}
+	}
+
+private:
+	static constexpr auto words_per_block = std::size_t(8);
+
+	span<bitset_word const> m_words;
+	vector<std::uint64_t> m_block_ranks;
+	std::size_t m_count = 0;
+};
+
+} // namespace containers
@@ -0,0 +1,126 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.find_all;
+
+import containers.algorithms.sort.is_sorted;
+
+import containers.algorithms.binary_search;
+import containers.associative_container;
+import containers.begin_end;
+import containers.clear;
+import containers.contiguous_range;
+import containers.data;
+import containers.forward_range;
+import containers.iter_difference_t;
+import containers.iterator;
+import containers.iterator_t;
+import containers.push_back;
+import containers.size;
+import containers.static_vector;
+import containers.subrange;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Enough independent searches to keep many cache misses in flight at once
+constexpr auto interleaved_searches = 16_bi;
+
+constexpr auto prefetch(auto const * const ptr) -> void {
+	if !consteval {
+		__builtin_prefetch(ptr);
+	}
+}
+
+// Runs a branchless binary search for each key in lock step. Each search
+// prefetches both of the elements it might look at next, so the memory
+// latency of the searches overlaps.
+constexpr auto interleaved_lower_bounds(auto const * const data, std::size_t const size, auto const & keys, auto & results, auto const compare) -> void {
+	for (auto & base : results) {
+		base = 0;
+	}
+	if (size == 0) {
+		return;
+	}
+	auto remaining = size;
+	while (remaining > 1) {
+		auto const half = remaining / 2;
+		auto const next_half = (remaining - half) / 2;
+		std::size_t lane = 0;
+		for (auto const it : keys) {
+			auto & base = results[lane];
+			::containers::prefetch(data + base + next_half);
+			::containers::prefetch(data + base + half + next_half);
+			base = compare(data[base + half], *it) ? base + half : base;
+			++lane;
+		}
+		remaining -= half;
+	}
+	std::size_t lane = 0;
+	for (auto const it : keys) {
+		auto & base = results[lane];
+		base += compare(data[base], *it) ? 1U : 0U;
+		++lane;
+	}
+}
+
+// Looks up each element of `queries` in `map` and writes the result of
+// `map.find` for each one to `output`, in the order of `queries`. If the
+// queries are sorted, this is a merge join that gallops forward through the
+// map. Otherwise, the binary searches for groups of queries are interleaved.
+// Either way, this is much faster than calling `find` in a loop for large
+// maps. Returns the end of the output.
+struct find_all_t {
+	template<associative_range Map, forward_range Queries> requires contiguous_range<Map>
+	static constexpr auto operator()(Map && map, Queries && queries, iterator auto output) {
+		auto const compare = map.compare();
+		auto const data = containers::data(map);
+		auto const size = static_cast<std::size_t>(containers::size(map));
+		auto const result = [&](std::size_t const index, auto const & key) {
+			using difference_type = iter_difference_t<iterator_t<Map &>>;
+			return (index == size or compare(key, data[index])) ?
+				containers::end(map) :
+				containers::begin(map) + ::bounded::assume_in_range<difference_type>(index);
+		};
+		if (::containers::is_sorted(queries, compare)) {
+			std::size_t position = 0;
+			for (auto const & key : queries) {
+				// Each search starts from the previous match
+				position = static_cast<std::size_t>(::containers::gallop_lower_bound(subrange(data + position, data + size), key, compare) - data);
+				*output = result(position, key);
+				++output;
+			}
+		} else {
+			auto keys = static_vector<iterator_t<Queries &>, interleaved_searches>();
+			auto positions = std::array<std::size_t, static_cast<std::size_t>(interleaved_searches)>();
+			auto flush = [&] {
+				::containers::interleaved_lower_bounds(data, size, keys, positions, compare);
+				std::size_t lane = 0;
+				for (auto const it : keys) {
+					*output = result(positions[lane], *it);
+					++output;
+					++lane;
+				}
+				::containers::clear(keys);
+			};
+			auto const last = containers::end(queries);
+			for (auto it = containers::begin(queries); it != last; ++it) {
+				::containers::push_back(keys, it);
+				if (containers::size(keys) == interleaved_searches) {
+					flush();
+				}
+			}
+			flush();
+		}
+		return output;
+	}
+};
+export constexpr auto find_all = find_all_t();
+
+} // namespace containers
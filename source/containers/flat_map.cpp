@@ -11,28 +11,35 @@ module;
 
 export module containers.flat_map;
 
+import containers.algorithms.sort.auto_sort;
 import containers.algorithms.sort.is_sorted;
-import containers.algorithms.sort.ska_sort;
+import containers.algorithms.sort.merge_relocate_second_range;
 import containers.algorithms.sort.to_radix_sort_key;
 
 import containers.algorithms.advance;
 import containers.algorithms.binary_search;
 import containers.algorithms.erase;
+import containers.algorithms.find;
 import containers.algorithms.keyed_binary_search;
+import containers.algorithms.uninitialized;
 import containers.algorithms.unique;
 import containers.append;
 import containers.associative_container;
 import containers.begin_end;
 import containers.c_array;
+import containers.can_set_size;
 import containers.common_functions;
 import containers.compare_container;
 import containers.contiguous_range;
 import containers.data;
 import containers.dereference;
+import containers.exponential_force_reserve;
 import containers.extract_key_to_less;
 import containers.initializer_range;
 import containers.insert;
+import containers.iter_difference_t;
 import containers.iterator_t;
+import containers.lazy_push_back;
 import containers.legacy_iterator;
 import containers.lookup;
 import containers.map_tags;
@@ -43,6 +50,8 @@ import containers.push_back;
 import containers.range;
 import containers.range_size_t;
 import containers.range_value_t;
+import containers.reservable;
+import containers.sbo_vector;
 import containers.size;
 import containers.static_vector;
 import containers.subrange;
@@ -53,6 +62,8 @@ import bounded;
 import numeric_traits;
 import std_module;
 
+using namespace bounded::literal;
+
 namespace containers {
 
 template<typename T, typename ExtractKey>
@@ -67,6 +78,10 @@ struct extract_map_key {
 	constexpr decltype(auto) operator()(typename T::key_type const & key) const {
 		return m_extract(key);
 	}
+	// The function the map was constructed with, which works on keys
+	constexpr auto key_function() const -> ExtractKey const & {
+		return m_extract;
+	}
 private:
 	ExtractKey m_extract;
 };
@@ -77,12 +92,118 @@ concept extract_key_function = requires(ExtractKey const & extract_key, T const
 	extract_key(value);
 };
 
+template<typename Container>
+concept mergeable_in_spare_capacity =
+	contiguous_range<Container> and
+	can_set_size<Container> and
+	requires(Container const & container) { container.capacity(); };
+
+template<typename Container>
+constexpr auto reserve_for_merge(Container & container, auto const required_capacity) -> bool {
+	if (container.capacity() >= required_capacity) {
+		return true;
+	}
+	if constexpr (reservable<Container>) {
+		::containers::exponential_force_reserve(container, container.capacity(), required_capacity);
+		return true;
+	} else {
+		return false;
+	}
+}
+
+// Both ranges must be sorted and unique. Each search gallops forward from the
+// previous match, so a batch of m elements costs O(m log(n / m)) comparisons.
+constexpr auto count_equivalent(range auto const & sorted, range auto const & batch, auto const compare) -> std::size_t {
+	auto it = containers::begin(sorted);
+	auto const last = containers::end(sorted);
+	std::size_t count = 0;
+	for (auto const & value : batch) {
+		it = ::containers::gallop_lower_bound(subrange(it, last), value, compare);
+		if (it == last) {
+			break;
+		}
+		if (!compare(value, *it)) {
+			++count;
+		}
+	}
+	return count;
+}
+
+// `midpoint` separates the sorted elements from a sorted batch. The batch is
+// relocated into the spare capacity of `container` and merged backward into
+// place, so there is no temporary buffer. Returns false without merging if the
+// container cannot grow enough to hold both.
+template<bool allow_duplicates, typename Container>
+constexpr auto merge_in_spare_capacity(Container & container, iterator_t<Container> const midpoint, auto const compare) -> bool {
+	auto const sorted_size = static_cast<std::size_t>(midpoint - ::containers::begin(container));
+	if constexpr (!allow_duplicates) {
+		::containers::erase_to_end(
+			container,
+			::containers::unique_less(midpoint, ::containers::end(container), compare)
+		);
+	}
+	auto const size = static_cast<std::size_t>(::containers::size(container));
+	auto const batch_size = size - sorted_size;
+	if (sorted_size == 0 or batch_size == 0) {
+		return true;
+	}
+	auto const required_capacity = ::containers::size(container) + ::bounded::assume_in_range<range_size_t<Container>>(batch_size);
+	if (!::containers::reserve_for_merge(container, required_capacity)) {
+		return false;
+	}
+	auto const first = ::containers::data(container);
+	auto const sorted = subrange(first, first + sorted_size);
+	auto const batch = subrange(first + size, first + size + batch_size);
+	::containers::uninitialized_relocate_no_overlap(subrange(first + sorted_size, first + size), first + size);
+	if constexpr (allow_duplicates) {
+		::containers::merge_relocate_second_range(sorted, batch, first + size, compare);
+	} else {
+		auto const duplicates = ::containers::count_equivalent(sorted, batch, compare);
+		::containers::unique_merge_relocate_second_range(sorted, batch, first + size - duplicates, compare);
+		container.set_size(::bounded::assume_in_range<range_size_t<Container>>(size - duplicates));
+	}
+	return true;
+}
+
+// Whether the batch starting at `midpoint` is sorted and belongs after every
+// element before it, which is common when keys arrive in increasing order. For
+// maps the batch must be strictly increasing so that it has no duplicates.
+template<bool allow_duplicates, typename Container>
+constexpr auto is_ordered_append(Container & container, iterator_t<Container> const midpoint, auto const compare) -> bool {
+	auto const in_order = [&](auto const & before, auto const & after) {
+		if constexpr (allow_duplicates) {
+			return !compare(after, before);
+		} else {
+			return compare(before, after);
+		}
+	};
+	auto const last = ::containers::end(container);
+	if (midpoint == last) {
+		return true;
+	}
+	if (midpoint != ::containers::begin(container) and !in_order(*containers::prev(midpoint), *midpoint)) {
+		return false;
+	}
+	return ::containers::is_sorted(
+		subrange(midpoint, last),
+		[&](auto const & after, auto const & before) { return !in_order(before, after); }
+	);
+}
+
 template<bool allow_duplicates, typename Container>
 constexpr auto merge_sorted_and_unsorted(Container & container, iterator_t<Container> midpoint, auto const extract_key) {
+	auto const compare = ::containers::extract_key_to_less(extract_key);
+	if (::containers::is_ordered_append<allow_duplicates>(container, midpoint, compare)) {
+		return;
+	}
+	auto_sort(subrange(midpoint, ::containers::end(container)), extract_key);
+	if constexpr (mergeable_in_spare_capacity<Container>) {
+		if (::containers::merge_in_spare_capacity<allow_duplicates>(container, midpoint, compare)) {
+			return;
+		}
+	}
 	auto const first = ::containers::begin(container);
 	auto const last = ::containers::end(container);
-	auto const compare = ::containers::extract_key_to_less(extract_key);
-	ska_sort(subrange(midpoint, last), extract_key);
 	if constexpr (allow_duplicates) {
 		std::inplace_merge(
 			maybe_legacy_iterator(first),
@@ -134,9 +255,9 @@ struct flat_map_base : private lexicographical_comparison::base {
 		m_extract_key(std::move(extract_key_))
 	{
 		if constexpr (allow_duplicates) {
-			ska_sort(m_container, extract_key());
+			auto_sort(m_container, extract_key());
 		} else {
-			unique_ska_sort(m_container, extract_key());
+			unique_auto_sort(m_container, extract_key());
 		}
 	}
 	constexpr explicit flat_map_base(constructor_initializer_range<flat_map_base> auto && source):
@@ -159,7 +280,7 @@ struct flat_map_base : private lexicographical_comparison::base {
 		m_container(OPERATORS_FORWARD(source)),
 		m_extract_key(std::move(extract_key_))
 	{
-		ska_sort(m_container, extract_key());
+		auto_sort(m_container, extract_key());
 	}
 	constexpr flat_map_base(assume_unique_t, constructor_initializer_range<flat_map_base> auto && source):
 		flat_map_base(assume_unique, OPERATORS_FORWARD(source), ExtractKey())
@@ -172,9 +293,9 @@ struct flat_map_base : private lexicographical_comparison::base {
 		m_extract_key(std::move(extract_key_))
 	{
 		if constexpr (allow_duplicates) {
-			ska_sort(m_container, extract_key());
+			auto_sort(m_container, extract_key());
 		} else {
-			unique_ska_sort(m_container, extract_key());
+			unique_auto_sort(m_container, extract_key());
 		}
 	}
 	template<std::size_t init_size>
@@ -201,7 +322,7 @@ struct flat_map_base : private lexicographical_comparison::base {
 		m_container(std::move(source)),
 		m_extract_key(std::move(extract_key_))
 	{
-		ska_sort(m_container, extract_key());
+		auto_sort(m_container, extract_key());
 	}
 	template<std::size_t init_size>
 	constexpr flat_map_base(assume_unique_t, c_array<value_type, init_size> && source):
@@ -263,6 +384,39 @@ struct flat_map_base : private lexicographical_comparison::base {
 		}
 	}
 
+	// `hint` is where the element is expected to go. If the element belongs
+	// immediately before `hint`, it is inserted there without a search, so
+	// inserting keys in increasing order with a hint of `end()` is a
+	// `push_back`. Otherwise, this is the same as inserting without a hint.
+	template<typename Key = key_type>
+	constexpr auto lazy_insert(const_iterator const hint, Key && key, bounded::construct_function_for<mapped_type> auto && mapped) {
+		auto const first = ::containers::begin(std::as_const(m_container));
+		auto const last = ::containers::end(std::as_const(m_container));
+		auto const in_order = [&](auto const & before, auto const & after) {
+			if constexpr (allow_duplicates) {
+				return !compare()(after, before);
+			} else {
+				return compare()(before, after);
+			}
+		};
+		bool const belongs_at_hint =
+			(hint == first or in_order(get_key(*containers::prev(hint)), key)) and
+			(hint == last or in_order(key, get_key(*hint)));
+		if (!belongs_at_hint) {
+			return lazy_insert(OPERATORS_FORWARD(key), OPERATORS_FORWARD(mapped));
+		}
+		auto const it = ::containers::lazy_insert(
+			m_container,
+			hint,
+			[&] { return value_type{OPERATORS_FORWARD(key), OPERATORS_FORWARD(mapped)()}; }
+		);
+		if constexpr (allow_duplicates) {
+			return it;
+		} else {
+			return inserted_t{it, true};
+		}
+	}
+
 	constexpr auto insert(range auto && init) -> void {
 		// Because my underlying container is expected to be contiguous storage,
 		// it's best to do a batch insert and then just sort it all.
@@ -278,7 +432,7 @@ struct flat_map_base : private lexicographical_comparison::base {
 	constexpr auto erase(const_iterator const first, const_iterator const last) {
 		return containers::erase(m_container, first, last);
 	}
-	constexpr auto erase_if(auto const predicate) {
+	constexpr auto erase_if(auto predicate) {
 		return containers::erase_if(m_container, predicate);
 	}
 
@@ -405,6 +559,452 @@ basic_flat_multimap(assume_sorted_unique_t, Range &&) -> basic_flat_multimap<std
 template<typename Range, typename ExtractKey>
 basic_flat_multimap(assume_sorted_unique_t, Range &&, ExtractKey) -> basic_flat_multimap<std::remove_const_t<Range>, ExtractKey>;
 
+// Stores its elements in a single contiguous container that is split into a
+// sorted prefix and an unsorted tail of recent insertions. Inserting an element
+// appends it to the tail. Once the tail is longer than about the square root
+// of the size of the map, it is sorted and merged into the prefix before the
+// next insertion. This makes a run of insertions cost amortized O(sqrt(n))
+// element moves each rather than O(n), at the cost of a linear search of the
+// tail in each lookup. Iteration visits every element, but visits them in
+// sorted order only after a call to `merge`.
+export template<typename Container, extract_key_function<typename range_value_t<Container>::key_type> ExtractKey = to_radix_sort_key_t>
+class basic_log_flat_map {
+public:
+	using value_type = range_value_t<Container>;
+	using key_type = typename value_type::key_type;
+	using mapped_type = typename value_type::mapped_type;
+
+	using const_iterator = iterator_t<Container const &>;
+
+	constexpr auto extract_key() const {
+		return extract_map_key<value_type, ExtractKey>(m_extract_key);
+	}
+	constexpr auto compare() const {
+		return ::containers::extract_key_to_less(extract_key());
+	}
+
+	basic_log_flat_map() = default;
+	constexpr explicit basic_log_flat_map(ExtractKey extract_key_):
+		m_extract_key(std::move(extract_key_))
+	{
+	}
+	constexpr basic_log_flat_map(constructor_initializer_range<basic_log_flat_map> auto && source, ExtractKey extract_key_):
+		m_container(OPERATORS_FORWARD(source)),
+		m_extract_key(std::move(extract_key_))
+	{
+		unique_auto_sort(m_container, extract_key());
+		m_sorted_size = ::containers::size(m_container);
+	}
+	constexpr explicit basic_log_flat_map(constructor_initializer_range<basic_log_flat_map> auto && source):
+		basic_log_flat_map(OPERATORS_FORWARD(source), ExtractKey())
+	{
+	}
+
+	constexpr auto begin() const {
+		return ::containers::begin(m_container);
+	}
+	constexpr auto begin() {
+		return ::containers::begin(m_container);
+	}
+	constexpr auto size() const {
+		return ::containers::size(m_container);
+	}
+
+	constexpr auto capacity() const {
+		return m_container.capacity();
+	}
+	constexpr auto reserve(range_size_t<Container> const new_capacity) {
+		return m_container.reserve(new_capacity);
+	}
+
+	constexpr auto find(auto const & key) const {
+		return find_impl(*this, key);
+	}
+	constexpr auto find(auto const & key) {
+		return find_impl(*this, key);
+	}
+
+	template<typename Key = key_type>
+	constexpr auto lazy_insert(Key && key, bounded::construct_function_for<mapped_type> auto && mapped) {
+		auto const existing = find(key);
+		if (existing != ::containers::end(*this)) {
+			return inserted_t{existing, false};
+		}
+		if (tail_is_full()) {
+			merge();
+		}
+		::containers::lazy_push_back(
+			m_container,
+			[&] { return value_type{OPERATORS_FORWARD(key), OPERATORS_FORWARD(mapped)()}; }
+		);
+		return inserted_t{containers::prev(::containers::end(*this)), true};
+	}
+
+	// Batches are large enough that merging them immediately is cheaper than
+	// searching them linearly.
+	constexpr auto insert(range auto && init) -> void {
+		::containers::append(m_container, OPERATORS_FORWARD(init));
+		merge();
+	}
+
+	// Sorts the tail and merges it into the sorted prefix
+	constexpr auto merge() -> void {
+		if (m_sorted_size == ::containers::size(m_container)) {
+			return;
+		}
+		auto const midpoint = begin() + m_sorted_size;
+		::containers::merge_sorted_and_unsorted<false>(m_container, midpoint, extract_key());
+		m_sorted_size = ::containers::size(m_container);
+	}
+	constexpr auto is_merged() const -> bool {
+		return m_sorted_size == ::containers::size(m_container);
+	}
+
+	constexpr auto erase(const_iterator const it) {
+		if (it - ::containers::begin(std::as_const(m_container)) < m_sorted_size) {
+			--m_sorted_size;
+		}
+		return containers::erase(m_container, it);
+	}
+
+private:
+	static constexpr auto find_impl(auto & map, auto const & key) {
+		auto const compare = map.compare();
+		auto const sorted_end = map.begin() + map.m_sorted_size;
+		auto const it = containers::lower_bound(subrange(map.begin(), sorted_end), key, compare);
+		if (it != sorted_end and !compare(key, get_key(*it))) {
+			return it;
+		}
+		return containers::find_if(
+			subrange(sorted_end, ::containers::end(map)),
+			[&](auto const & value) { return !compare(key, get_key(value)) and !compare(get_key(value), key); }
+		);
+	}
+
+	constexpr auto tail_is_full() const -> bool {
+		auto const tail_size = static_cast<std::size_t>(::containers::size(m_container) - m_sorted_size);
+		return tail_size * tail_size > static_cast<std::size_t>(m_sorted_size);
+	}
+
+	Container m_container;
+	range_size_t<Container> m_sorted_size = 0_bi;
+	[[no_unique_address]] ExtractKey m_extract_key;
+};
+
+template<typename Range>
+basic_log_flat_map(Range &&) -> basic_log_flat_map<std::remove_const_t<Range>>;
+template<typename Range, typename ExtractKey>
+basic_log_flat_map(Range &&, ExtractKey) -> basic_log_flat_map<std::remove_const_t<Range>, ExtractKey>;
+
+// Keeps its elements unsorted while there are at most `linear_size` of them,
+// and finds them with a linear scan. When it grows past that, it sorts its
+// elements and from then on acts like a `flat_map`. With an `sbo_vector`, a
+// small map does not allocate. Iteration is in insertion order while the map
+// is small and in sorted order after that.
+export template<typename Container, std::size_t linear_size, extract_key_function<typename range_value_t<Container>::key_type> ExtractKey = to_radix_sort_key_t>
+class basic_small_flat_map {
+public:
+	using value_type = range_value_t<Container>;
+	using key_type = typename value_type::key_type;
+	using mapped_type = typename value_type::mapped_type;
+
+	using const_iterator = iterator_t<Container const &>;
+
+	constexpr auto extract_key() const {
+		return extract_map_key<value_type, ExtractKey>(m_extract_key);
+	}
+	constexpr auto compare() const {
+		return ::containers::extract_key_to_less(extract_key());
+	}
+
+	basic_small_flat_map() = default;
+	constexpr explicit basic_small_flat_map(ExtractKey extract_key_):
+		m_extract_key(std::move(extract_key_))
+	{
+	}
+	constexpr basic_small_flat_map(constructor_initializer_range<basic_small_flat_map> auto && source, ExtractKey extract_key_):
+		m_container(OPERATORS_FORWARD(source)),
+		m_extract_key(std::move(extract_key_))
+	{
+		unique_auto_sort(m_container, extract_key());
+	}
+	constexpr explicit basic_small_flat_map(constructor_initializer_range<basic_small_flat_map> auto && source):
+		basic_small_flat_map(OPERATORS_FORWARD(source), ExtractKey())
+	{
+	}
+
+	constexpr auto begin() const {
+		return ::containers::begin(m_container);
+	}
+	constexpr auto begin() {
+		return ::containers::begin(m_container);
+	}
+	constexpr auto size() const {
+		return ::containers::size(m_container);
+	}
+
+	constexpr auto capacity() const {
+		return m_container.capacity();
+	}
+	constexpr auto reserve(range_size_t<Container> const new_capacity) {
+		return m_container.reserve(new_capacity);
+	}
+
+	// Whether the elements might not be sorted
+	constexpr auto is_linear() const -> bool {
+		return static_cast<std::size_t>(size()) <= linear_size;
+	}
+
+	constexpr auto find(auto const & key) const {
+		return find_impl(*this, key);
+	}
+	constexpr auto find(auto const & key) {
+		return find_impl(*this, key);
+	}
+
+	template<typename Key = key_type>
+	constexpr auto lazy_insert(Key && key, bounded::construct_function_for<mapped_type> auto && mapped) {
+		auto make_value = [&] { return value_type{OPERATORS_FORWARD(key), OPERATORS_FORWARD(mapped)()}; };
+		if (is_linear()) {
+			auto const existing = find(key);
+			if (existing != ::containers::end(*this)) {
+				return inserted_t{existing, false};
+			}
+			if (static_cast<std::size_t>(size()) < linear_size) {
+				::containers::lazy_push_back(m_container, make_value);
+				return inserted_t{containers::prev(::containers::end(*this)), true};
+			}
+			// This element makes the map too large to search linearly
+			auto_sort(m_container, extract_key());
+		}
+		auto const position = ::containers::upper_bound(m_container, key, compare());
+		if (position != begin() and !compare()(get_key(*containers::prev(position)), key)) {
+			return inserted_t{containers::prev(position), false};
+		}
+		return inserted_t{::containers::lazy_insert(m_container, position, make_value), true};
+	}
+
+	// If a key is already in the map, the existing element is kept
+	constexpr auto insert(range auto && init) -> void {
+		auto const original_size = ::containers::size(m_container);
+		auto const was_linear = is_linear();
+		::containers::append(m_container, OPERATORS_FORWARD(init));
+		auto const midpoint = begin() + original_size;
+		if (was_linear) {
+			auto_sort(subrange(begin(), midpoint), extract_key());
+		}
+		::containers::merge_sorted_and_unsorted<false>(m_container, midpoint, extract_key());
+	}
+
+	constexpr auto erase(const_iterator const it) {
+		return containers::erase(m_container, it);
+	}
+
+private:
+	static constexpr auto find_impl(auto & map, auto const & key) {
+		auto const compare = map.compare();
+		if (map.is_linear()) {
+			return containers::find_if(
+				map.m_container,
+				[&](auto const & value) { return !compare(key, get_key(value)) and !compare(get_key(value), key); }
+			);
+		}
+		auto const it = containers::lower_bound(map.m_container, key, compare);
+		return (it == ::containers::end(map.m_container) or compare(key, get_key(*it))) ? ::containers::end(map.m_container) : it;
+	}
+
+	Container m_container;
+	[[no_unique_address]] ExtractKey m_extract_key;
+};
+
+// Removes every element whose key is in `keys`. `keys` may be in any order and
+// may contain duplicates or keys that are not in the map. Unsorted keys are
+// sorted once, and then they are joined against the map during a single
+// compaction pass, so erasing k keys is O(n + k log(k)) rather than the O(n * k)
+// of erasing them one at a time. Returns the number of elements erased.
+struct erase_keys_t {
+	template<typename Map>
+	static constexpr auto operator()(Map & map, range auto && keys) {
+		if (::containers::is_sorted(keys, map.compare())) {
+			return erase_sorted_keys(map, keys);
+		}
+		auto sorted = vector<typename Map::key_type>(OPERATORS_FORWARD(keys));
+		::containers::auto_sort(sorted, map.extract_key());
+		return erase_sorted_keys(map, sorted);
+	}
+
+private:
+	static constexpr auto erase_sorted_keys(auto & map, range auto const & keys) {
+		auto const compare = map.compare();
+		auto it = ::containers::begin(keys);
+		auto const last = ::containers::end(keys);
+		return map.erase_if([&](auto const & value) {
+			auto const & key = get_key(value);
+			while (it != last and compare(*it, key)) {
+				++it;
+			}
+			return it != last and !compare(key, *it);
+		});
+	}
+};
+export constexpr auto erase_keys = erase_keys_t();
+
+// The set operations below build a new map of the same type as their
+// arguments in a single merge pass. Each element is appended with an `end()`
+// hint, so building the result never searches or shifts elements. They
+// require maps with unique keys.
+
+struct keep_first_mapped_t {
+	static constexpr auto operator()(auto const & lhs, auto const &) -> auto const & {
+		return lhs;
+	}
+};
+
+template<typename Map>
+constexpr auto reserve_for_set_operation(Map & result, auto const count) -> void {
+	if constexpr (requires { result.reserve(result.size()); }) {
+		using size_type = decltype(result.size());
+		result.reserve(::bounded::assume_in_range<size_type>(bounded::min(count, numeric_traits::max_value<size_type>)));
+	}
+}
+
+template<typename Map>
+constexpr auto append_to_map(Map & result, auto const & key, auto && mapped) -> void {
+	result.lazy_insert(
+		::containers::end(std::as_const(result)),
+		key,
+		[&] { return typename Map::mapped_type(OPERATORS_FORWARD(mapped)); }
+	);
+}
+
+// Contains every key in either map. For a key in both maps, the mapped value
+// is `merge_mapped(lhs_mapped, rhs_mapped)`.
+struct map_union_t {
+	template<typename Map>
+	static constexpr auto operator()(Map const & lhs, Map const & rhs, auto const merge_mapped) -> Map {
+		auto const compare = lhs.compare();
+		auto result = Map(lhs.extract_key().key_function());
+		::containers::reserve_for_set_operation(result, lhs.size() + rhs.size());
+		auto lhs_it = ::containers::begin(lhs);
+		auto rhs_it = ::containers::begin(rhs);
+		auto const lhs_last = ::containers::end(lhs);
+		auto const rhs_last = ::containers::end(rhs);
+		while (lhs_it != lhs_last and rhs_it != rhs_last) {
+			if (compare(*lhs_it, *rhs_it)) {
+				::containers::append_to_map(result, get_key(*lhs_it), get_mapped(*lhs_it));
+				++lhs_it;
+			} else if (compare(*rhs_it, *lhs_it)) {
+				::containers::append_to_map(result, get_key(*rhs_it), get_mapped(*rhs_it));
+				++rhs_it;
+			} else {
+				::containers::append_to_map(result, get_key(*lhs_it), merge_mapped(get_mapped(*lhs_it), get_mapped(*rhs_it)));
+				++lhs_it;
+				++rhs_it;
+			}
+		}
+		for (; lhs_it != lhs_last; ++lhs_it) {
+			::containers::append_to_map(result, get_key(*lhs_it), get_mapped(*lhs_it));
+		}
+		for (; rhs_it != rhs_last; ++rhs_it) {
+			::containers::append_to_map(result, get_key(*rhs_it), get_mapped(*rhs_it));
+		}
+		return result;
+	}
+	template<typename Map>
+	static constexpr auto operator()(Map const & lhs, Map const & rhs) -> Map {
+		return operator()(lhs, rhs, keep_first_mapped_t());
+	}
+};
+export constexpr auto map_union = map_union_t();
+
+// Contains the keys that are in both maps, with a mapped value of
+// `merge_mapped(lhs_mapped, rhs_mapped)`. If one map is much smaller than the
+// other, this walks the smaller map and gallops through the larger one, which
+// costs O(m log(n / m)) comparisons rather than O(n + m).
+struct map_intersection_t {
+	template<typename Map>
+	static constexpr auto operator()(Map const & lhs, Map const & rhs, auto const merge_mapped) -> Map {
+		constexpr auto gallop_ratio = 8U;
+		auto const compare = lhs.compare();
+		auto result = Map(lhs.extract_key().key_function());
+		::containers::reserve_for_set_operation(result, bounded::min(lhs.size(), rhs.size()));
+		auto const add = [&](auto const & lhs_value, auto const & rhs_value) {
+			::containers::append_to_map(result, get_key(lhs_value), merge_mapped(get_mapped(lhs_value), get_mapped(rhs_value)));
+		};
+		auto const lhs_size = static_cast<std::size_t>(lhs.size());
+		auto const rhs_size = static_cast<std::size_t>(rhs.size());
+		if (lhs_size * gallop_ratio < rhs_size) {
+			auto it = ::containers::begin(rhs);
+			auto const last = ::containers::end(rhs);
+			for (auto const & value : lhs) {
+				it = ::containers::gallop_lower_bound(subrange(it, last), get_key(value), compare);
+				if (it == last) {
+					break;
+				}
+				if (!compare(value, *it)) {
+					add(value, *it);
+				}
+			}
+		} else if (rhs_size * gallop_ratio < lhs_size) {
+			auto it = ::containers::begin(lhs);
+			auto const last = ::containers::end(lhs);
+			for (auto const & value : rhs) {
+				it = ::containers::gallop_lower_bound(subrange(it, last), get_key(value), compare);
+				if (it == last) {
+					break;
+				}
+				if (!compare(value, *it)) {
+					add(*it, value);
+				}
+			}
+		} else {
+			auto lhs_it = ::containers::begin(lhs);
+			auto rhs_it = ::containers::begin(rhs);
+			auto const lhs_last = ::containers::end(lhs);
+			auto const rhs_last = ::containers::end(rhs);
+			while (lhs_it != lhs_last and rhs_it != rhs_last) {
+				if (compare(*lhs_it, *rhs_it)) {
+					++lhs_it;
+				} else if (compare(*rhs_it, *lhs_it)) {
+					++rhs_it;
+				} else {
+					add(*lhs_it, *rhs_it);
+					++lhs_it;
+					++rhs_it;
+				}
+			}
+		}
+		return result;
+	}
+	template<typename Map>
+	static constexpr auto operator()(Map const & lhs, Map const & rhs) -> Map {
+		return operator()(lhs, rhs, keep_first_mapped_t());
+	}
+};
+export constexpr auto map_intersection = map_intersection_t();
+
+// Contains the elements of `lhs` whose keys are not in `rhs`
+struct map_difference_t {
+	template<typename Map>
+	static constexpr auto operator()(Map const & lhs, Map const & rhs) -> Map {
+		auto const compare = lhs.compare();
+		auto result = Map(lhs.extract_key().key_function());
+		::containers::reserve_for_set_operation(result, lhs.size());
+		auto rhs_it = ::containers::begin(rhs);
+		auto const rhs_last = ::containers::end(rhs);
+		for (auto const & value : lhs) {
+			while (rhs_it != rhs_last and compare(*rhs_it, value)) {
+				++rhs_it;
+			}
+			if (rhs_it == rhs_last or compare(value, *rhs_it)) {
+				::containers::append_to_map(result, get_key(value), get_mapped(value));
+			}
+		}
+		return result;
+	}
+};
+export constexpr auto map_difference = map_difference_t();
+
 template<typename Key, typename Mapped>
 constexpr auto maximum_map_size = numeric_traits::max_value<array_size_type<map_value_type<Key, Mapped>>>;
 
@@ -420,6 +1020,12 @@ using flat_map = basic_flat_map<vector<map_value_type<Key, Mapped>, maximum_map_
 export template<typename Key, typename Mapped, array_size_type<map_value_type<Key, Mapped>> capacity, typename... MaybeExtractKey>
 using static_flat_map = basic_flat_map<static_vector<map_value_type<Key, Mapped>, capacity>, MaybeExtractKey...>;
 
+export template<typename Key, typename Mapped, typename... MaybeExtractKey>
+using log_flat_map = basic_log_flat_map<vector<map_value_type<Key, Mapped>, maximum_map_size<Key, Mapped>>, MaybeExtractKey...>;
+
+export template<typename Key, typename Mapped, std::size_t linear_size = 8, typename... MaybeExtractKey>
+using small_flat_map = basic_small_flat_map<sbo_vector<map_value_type<Key, Mapped>, linear_size>, linear_size, MaybeExtractKey...>;
+
 export template<typename Key, typename Mapped, typename... MaybeExtractKey>
 using flat_multimap = basic_flat_multimap<vector<map_value_type<Key, Mapped>>, MaybeExtractKey...>;
 
@@ -21,8 +21,15 @@ import bounded;
 
 namespace containers {
 
+export template<typename Container>
+concept member_lazy_push_frontable =
+	requires(Container container, bounded::function_ptr<range_value_t<Container>> constructor) {
+		container.lazy_push_front(constructor);
+	};
+
 export template<typename Container>
 concept lazy_push_frontable =
+	member_lazy_push_frontable<Container> or
 	supports_lazy_insert_after<Container> or
 	(bounded::default_constructible<Container> and lazy_push_backable<Container> and splicable<Container>);
 
@@ -32,7 +39,9 @@ constexpr auto lazy_push_front(
 	Container & container,
 	bounded::construct_function_for<range_value_t<Container>> auto && constructor
 ) -> auto & {
-	if constexpr (supports_lazy_insert_after<Container>) {
+	if constexpr (member_lazy_push_frontable<Container>) {
+		return container.lazy_push_front(OPERATORS_FORWARD(constructor));
+	} else if constexpr (supports_lazy_insert_after<Container>) {
 		return *container.lazy_insert_after(container.before_begin(), OPERATORS_FORWARD(constructor));
 	} else {
 		auto temp = Container();
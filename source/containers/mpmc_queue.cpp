@@ -0,0 +1,265 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <operators/forward.hpp>
+
+export module containers.mpmc_queue;
+
+import containers.begin_end;
+import containers.cache_line_size;
+import containers.dereference;
+import containers.iterator;
+import containers.maximum_array_size;
+import containers.range;
+import containers.subrange;
+import containers.uninitialized_dynamic_array;
+
+import bounded;
+import std_module;
+import tv;
+
+namespace containers {
+
+// The element is constructed and destroyed explicitly, according to the
+// sequence number
+template<typename T>
+struct mpmc_cell {
+	explicit mpmc_cell(std::size_t const initial_sequence):
+		sequence(initial_sequence)
+	{
+	}
+	~mpmc_cell() {
+	}
+
+	std::atomic<std::size_t> sequence;
+	union {
+		T value;
+	};
+};
+
+enum class claim_result {
+	claimed,
+	unavailable,
+	contended
+};
+
+// A bounded queue for any number of producer and consumer threads. Each cell
+// has a sequence number that says whether it is ready to be written or read for
+// a given position, so producers and consumers only contend with each other on
+// the shared positions, and only for a single compare and swap per element.
+//
+// When the queue is full or empty, the `try_` functions fail immediately. The
+// other functions wait on the sequence number of the cell they need, which is
+// a futex on Linux, so a blocked thread does not spin. The threads that change
+// a cell wake the waiters only if there are any.
+export template<typename T>
+struct mpmc_queue {
+	static_assert(std::is_nothrow_move_constructible_v<T>);
+
+	// The capacity is rounded up to a power of two, and is at least 2
+	explicit mpmc_queue(array_size_type<T> const capacity):
+		m_cells(::bounded::check_in_range<array_size_type<cell_t>>(std::bit_ceil(std::max(static_cast<std::size_t>(capacity), std::size_t(2)))))
+	{
+		for (std::size_t index = 0; index != this->capacity(); ++index) {
+			std::construct_at(m_cells.data() + index, index);
+		}
+	}
+	mpmc_queue(mpmc_queue const &) = delete;
+	auto operator=(mpmc_queue const &) -> mpmc_queue & = delete;
+
+	~mpmc_queue() {
+		auto const last = m_enqueue_position.value.load(std::memory_order_acquire);
+		for (auto position = m_dequeue_position.value.load(std::memory_order_acquire); position != last; ++position) {
+			bounded::destroy(cell_at(position).value);
+		}
+		for (std::size_t index = 0; index != capacity(); ++index) {
+			std::destroy_at(m_cells.data() + index);
+		}
+	}
+
+	auto capacity() const -> std::size_t {
+		return static_cast<std::size_t>(m_cells.capacity());
+	}
+
+	auto try_lazy_push(bounded::construct_function_for<T> auto && constructor) -> bool {
+		return push_impl<false>(OPERATORS_FORWARD(constructor));
+	}
+	auto try_push(T const & value) -> bool {
+		return try_lazy_push(bounded::value_to_function(value));
+	}
+	auto try_push(T && value) -> bool {
+		return try_lazy_push([&] noexcept { return std::move(value); });
+	}
+
+	// Waits for space if the queue is full
+	auto lazy_push(bounded::construct_function_for<T> auto && constructor) -> void {
+		push_impl<true>(OPERATORS_FORWARD(constructor));
+	}
+	auto push(T const & value) -> void {
+		lazy_push(bounded::value_to_function(value));
+	}
+	auto push(T && value) -> void {
+		lazy_push([&] noexcept { return std::move(value); });
+	}
+
+	// Pushes elements of `source` until the queue is full. Returns the part of
+	// `source` that was not pushed.
+	template<range Source>
+	auto try_push_range(Source && source) {
+		auto it = containers::begin(source);
+		auto const last = containers::end(source);
+		for (; it != last; ++it) {
+			if (!try_lazy_push([&] -> decltype(auto) { return dereference<Source>(it); })) {
+				break;
+			}
+		}
+		return containers::subrange(it, last);
+	}
+	// Pushes all of `source`, waiting for space as needed
+	template<range Source>
+	auto push_range(Source && source) -> void {
+		auto const last = containers::end(source);
+		for (auto it = containers::begin(source); it != last; ++it) {
+			lazy_push([&] -> decltype(auto) { return dereference<Source>(it); });
+		}
+	}
+
+	auto try_pop() -> tv::optional<T> {
+		return pop_impl<false>();
+	}
+	// Waits for an element if the queue is empty
+	auto pop() -> T {
+		return *pop_impl<true>();
+	}
+	// Pops up to `max_count` elements into `output` without waiting. Returns
+	// the end of the output.
+	auto try_pop_n(iterator auto output, std::size_t const max_count) {
+		for (std::size_t count = 0; count != max_count; ++count) {
+			auto value = try_pop();
+			if (!value) {
+				break;
+			}
+			*output = std::move(*value);
+			++output;
+		}
+		return output;
+	}
+
+private:
+	using cell_t = mpmc_cell<T>;
+
+	struct claim_t {
+		cell_t * cell;
+		std::size_t position;
+		std::size_t sequence;
+		claim_result result;
+	};
+
+	auto cell_at(std::size_t const position) -> cell_t & {
+		return m_cells.data()[position & (capacity() - 1U)];
+	}
+
+	// A cell is ready to be written at `position` when its sequence is
+	// `position`, and ready to be read when its sequence is `position + 1`.
+	auto try_claim(std::atomic<std::size_t> & next_position, std::size_t const ready_offset) -> claim_t {
+		auto position = next_position.load(std::memory_order_relaxed);
+		auto & cell = cell_at(position);
+		auto const sequence = cell.sequence.load(std::memory_order_acquire);
+		auto const difference = static_cast<std::ptrdiff_t>(sequence - (position + ready_offset));
+		auto const result =
+			difference < 0 ? claim_result::unavailable :
+			difference > 0 ? claim_result::contended :
+			next_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) ? claim_result::claimed :
+			claim_result::contended;
+		return claim_t(std::addressof(cell), position, sequence, result);
+	}
+
+	template<bool wait>
+	auto push_impl(auto && constructor) -> bool {
+		if constexpr (!nothrow_constructor<decltype(constructor)>) {
+			auto value = T(OPERATORS_FORWARD(constructor)());
+			return push_impl<wait>([&] noexcept { return std::move(value); });
+		} else {
+			while (true) {
+				auto const claim = try_claim(m_enqueue_position.value, 0);
+				switch (claim.result) {
+					case claim_result::claimed:
+						fill(claim, OPERATORS_FORWARD(constructor));
+						return true;
+					case claim_result::unavailable:
+						if constexpr (!wait) {
+							return false;
+						}
+						wait_for_change(claim);
+						break;
+					case claim_result::contended:
+						break;
+				}
+			}
+		}
+	}
+	template<bool wait>
+	auto pop_impl() -> tv::optional<T> {
+		while (true) {
+			auto const claim = try_claim(m_dequeue_position.value, 1);
+			switch (claim.result) {
+				case claim_result::claimed:
+					return tv::optional<T>(take(claim));
+				case claim_result::unavailable:
+					if constexpr (!wait) {
+						return tv::none;
+					}
+					wait_for_change(claim);
+					break;
+				case claim_result::contended:
+					break;
+			}
+		}
+	}
+
+	// Once a position is claimed, there is no way to give it back, so the
+	// consumer that gets it would wait forever if the construction threw. A
+	// constructor that can throw is run before claiming a position.
+	template<typename Constructor>
+	static constexpr auto nothrow_constructor = noexcept(T(bounded::declval<Constructor>()()));
+
+	auto fill(claim_t const claim, auto && constructor) -> void {
+		bounded::construct_at(claim.cell->value, OPERATORS_FORWARD(constructor));
+		publish(*claim.cell, claim.position + 1);
+	}
+	auto take(claim_t const claim) -> T {
+		auto result = bounded::relocate(claim.cell->value);
+		publish(*claim.cell, claim.position + capacity());
+		return result;
+	}
+
+	auto publish(cell_t & cell, std::size_t const sequence) -> void {
+		cell.sequence.store(sequence, std::memory_order_seq_cst);
+		if (m_waiters.value.load(std::memory_order_seq_cst) != 0) {
+			cell.sequence.notify_all();
+		}
+	}
+	auto wait_for_change(claim_t const claim) -> void {
+		m_waiters.value.fetch_add(1, std::memory_order_seq_cst);
+		if (claim.cell->sequence.load(std::memory_order_seq_cst) == claim.sequence) {
+			claim.cell->sequence.wait(claim.sequence, std::memory_order_acquire);
+		}
+		m_waiters.value.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	template<typename Value>
+	struct alignas(cache_line_size) padded {
+		Value value{};
+	};
+
+	padded<std::atomic<std::size_t>> m_enqueue_position;
+	padded<std::atomic<std::size_t>> m_dequeue_position;
+	padded<std::atomic<std::uint32_t>> m_waiters;
+	uninitialized_dynamic_array<cell_t, array_size_type<cell_t>> m_cells;
+};
+
+} // namespace containers
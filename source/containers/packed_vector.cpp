@@ -0,0 +1,390 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+#include <operators/forward.hpp>
+
+export module containers.packed_vector;
+
+import containers.back;
+import containers.begin_end;
+import containers.clear;
+export import containers.common_iterator_functions;
+import containers.compare_container;
+import containers.initializer_range;
+import containers.iterator;
+import containers.maximum_array_size;
+import containers.pop_back;
+import containers.push_back;
+import containers.range;
+import containers.size;
+import containers.sized_range;
+import containers.vector;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+using packed_word = std::uint64_t;
+constexpr auto packed_word_bits = std::size_t(64);
+
+// Shifting by the width of the type is undefined, but an element of 64 bits
+// shifts a whole word out
+constexpr auto shift_left(packed_word const value, std::size_t const count) -> packed_word {
+	return count == packed_word_bits ? 0 : value << count;
+}
+constexpr auto shift_right(packed_word const value, std::size_t const count) -> packed_word {
+	return count == packed_word_bits ? 0 : value >> count;
+}
+
+// An element is stored as its distance from the minimum value, in just enough
+// bits to hold the distance to the maximum value
+template<bounded::bounded_integer T>
+struct packed_traits {
+	static constexpr auto min = numeric_traits::min_value<T>;
+	static constexpr auto max = numeric_traits::max_value<T>;
+	static_assert(max - min <= numeric_traits::max_value<packed_word>, "Elements must fit in 64 bits.");
+
+	static constexpr auto bits = static_cast<std::size_t>(std::bit_width(static_cast<packed_word>(max - min)));
+	static constexpr auto mask = shift_left(1, bits) - 1U;
+	// If the word size is not a multiple of the element size, some elements
+	// are split across two words
+	static constexpr auto can_straddle = bits != 0 and packed_word_bits % bits != 0;
+
+	static constexpr auto word_count(std::size_t const size) -> std::size_t {
+		return (size * bits + packed_word_bits - 1U) / packed_word_bits;
+	}
+
+	static constexpr auto encode(T const value) -> packed_word {
+		return static_cast<packed_word>(value - min);
+	}
+	static constexpr auto decode(packed_word const bits_value) -> T {
+		using offset_type = bounded::integer<0, bounded::normalize<max - min>>;
+		return T(min + ::bounded::assume_in_range<offset_type>(bits_value));
+	}
+
+	static constexpr auto read(packed_word const * const words, std::size_t const index) -> T {
+		if constexpr (bits == 0) {
+			return decode(0);
+		} else {
+			auto const bit = index * bits;
+			auto const offset = bit % packed_word_bits;
+			auto result = words[bit / packed_word_bits] >> offset;
+			if constexpr (can_straddle) {
+				if (offset + bits > packed_word_bits) {
+					result |= words[bit / packed_word_bits + 1U] << (packed_word_bits - offset);
+				}
+			}
+			return decode(result & mask);
+		}
+	}
+	static constexpr auto write(packed_word * const words, std::size_t const index, T const value) -> void {
+		if constexpr (bits != 0) {
+			auto const encoded = encode(value);
+			auto const bit = index * bits;
+			auto const offset = bit % packed_word_bits;
+			auto & word = words[bit / packed_word_bits];
+			word = (word & ~(mask << offset)) | (encoded << offset);
+			if constexpr (can_straddle) {
+				if (offset + bits > packed_word_bits) {
+					auto const high_bits = packed_word_bits - offset;
+					auto & next = words[bit / packed_word_bits + 1U];
+					next = (next & ~(mask >> high_bits)) | (encoded >> high_bits);
+				}
+			}
+		}
+	}
+};
+
+// Refers to one element of a packed_vector. Reading it unpacks the element,
+// and assigning to it packs the new value in place.
+export template<bounded::bounded_integer T>
+struct packed_reference {
+	constexpr packed_reference(packed_word * const words, std::size_t const index):
+		m_words(words),
+		m_index(index)
+	{
+	}
+
+	constexpr operator T() const {
+		return packed_traits<T>::read(m_words, m_index);
+	}
+	constexpr auto operator=(T const value) const -> packed_reference const & {
+		packed_traits<T>::write(m_words, m_index, value);
+		return *this;
+	}
+	constexpr auto operator=(packed_reference const & other) const -> packed_reference const & {
+		return *this = T(other);
+	}
+
+	friend constexpr auto operator==(packed_reference const lhs, T const rhs) -> bool {
+		return T(lhs) == rhs;
+	}
+
+private:
+	packed_word * m_words;
+	std::size_t m_index;
+};
+
+template<bounded::bounded_integer T, bool is_const>
+struct packed_vector_iterator {
+private:
+	static constexpr auto max_difference = bounded::normalize<maximum_array_size<T>>;
+	using words_pointer = std::conditional_t<is_const, packed_word const *, packed_word *>;
+public:
+	using difference_type = bounded::integer<bounded::normalize<-max_difference>, max_difference>;
+
+	packed_vector_iterator() = default;
+	constexpr packed_vector_iterator(words_pointer const words, std::size_t const index):
+		m_words(words),
+		m_index(index)
+	{
+	}
+
+	constexpr operator packed_vector_iterator<T, true>() const requires(!is_const) {
+		return packed_vector_iterator<T, true>(m_words, m_index);
+	}
+
+	constexpr auto operator*() const {
+		if constexpr (is_const) {
+			return packed_traits<T>::read(m_words, m_index);
+		} else {
+			return packed_reference<T>(m_words, m_index);
+		}
+	}
+
+	friend constexpr auto operator+(packed_vector_iterator const it, difference_type const offset) -> packed_vector_iterator {
+		return packed_vector_iterator(
+			it.m_words,
+			static_cast<std::size_t>(static_cast<std::ptrdiff_t>(it.m_index) + static_cast<std::ptrdiff_t>(offset))
+		);
+	}
+	friend constexpr auto operator-(packed_vector_iterator const lhs, packed_vector_iterator const rhs) -> difference_type {
+		return ::bounded::assume_in_range<difference_type>(
+			static_cast<std::ptrdiff_t>(lhs.m_index) - static_cast<std::ptrdiff_t>(rhs.m_index)
+		);
+	}
+	friend constexpr auto operator<=>(packed_vector_iterator const lhs, packed_vector_iterator const rhs) {
+		return lhs.m_index <=> rhs.m_index;
+	}
+	friend constexpr auto operator==(packed_vector_iterator const lhs, packed_vector_iterator const rhs) -> bool {
+		return lhs.m_index == rhs.m_index;
+	}
+
+private:
+	words_pointer m_words = nullptr;
+	std::size_t m_index = 0;
+};
+
+// A sequence of bounded integers that stores each element in the fewest bits
+// that can hold every value of `T`: an element of `bounded::integer<0, 1000>`
+// takes 10 bits rather than 16. Elements are packed end to end in 64-bit words,
+// so an element can be split across two words.
+//
+// Individual elements are accessed through `packed_reference`. `unpack` and
+// `append` process a whole word at a time, which is much faster than going
+// through the iterators element by element.
+export template<bounded::bounded_integer T>
+struct packed_vector : private lexicographical_comparison::base {
+	using value_type = T;
+	using size_type = array_size_type<T>;
+	using const_iterator = packed_vector_iterator<T, true>;
+	using iterator = packed_vector_iterator<T, false>;
+	using reference = packed_reference<T>;
+
+	// The number of bits used for each element
+	static constexpr auto element_bits = packed_traits<T>::bits;
+
+	constexpr packed_vector() = default;
+
+	constexpr explicit packed_vector(constructor_initializer_range<packed_vector> auto && source) {
+		append(OPERATORS_FORWARD(source));
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(m_words.data(), 0);
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(m_words.data(), 0);
+	}
+	constexpr auto end() const -> const_iterator {
+		return const_iterator(m_words.data(), static_cast<std::size_t>(m_size));
+	}
+	constexpr auto end() -> iterator {
+		return iterator(m_words.data(), static_cast<std::size_t>(m_size));
+	}
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+
+	constexpr auto operator[](size_type const index) const -> T {
+		BOUNDED_ASSERT(index < m_size);
+		return packed_traits<T>::read(m_words.data(), static_cast<std::size_t>(index));
+	}
+	constexpr auto operator[](size_type const index) -> reference {
+		BOUNDED_ASSERT(index < m_size);
+		return reference(m_words.data(), static_cast<std::size_t>(index));
+	}
+
+	// The packed representation. Bits past the last element are unspecified.
+	constexpr auto words() const {
+		return m_words.data();
+	}
+	constexpr auto word_count() const -> std::size_t {
+		return packed_traits<T>::word_count(static_cast<std::size_t>(m_size));
+	}
+
+	constexpr auto capacity() const -> size_type {
+		if constexpr (element_bits == 0) {
+			return numeric_traits::max_value<size_type>;
+		} else {
+			auto const bits = static_cast<std::size_t>(m_words.capacity()) * packed_word_bits;
+			return ::bounded::assume_in_range<size_type>(std::min(bits / element_bits, static_cast<std::size_t>(maximum_array_size<T>)));
+		}
+	}
+	constexpr auto reserve(size_type const new_capacity) -> void {
+		m_words.reserve(::bounded::assume_in_range<array_size_type<packed_word>>(
+			packed_traits<T>::word_count(static_cast<std::size_t>(new_capacity))
+		));
+	}
+
+	constexpr auto push_back(T const value) & -> void {
+		auto const index = static_cast<std::size_t>(m_size);
+		if (packed_traits<T>::word_count(index + 1U) != ::containers::size(m_words)) {
+			::containers::push_back(m_words, packed_word(0));
+		}
+		packed_traits<T>::write(m_words.data(), index, value);
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+	}
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+		if (packed_traits<T>::word_count(static_cast<std::size_t>(m_size)) != ::containers::size(m_words)) {
+			::containers::pop_back(m_words);
+		}
+	}
+	// Keeps the allocated words
+	constexpr auto clear() & -> void {
+		::containers::clear(m_words);
+		m_size = 0_bi;
+	}
+
+	// Packs all of `source` onto the end. Whole words are built up in a
+	// register and stored once each, rather than reading and writing the
+	// destination word for every element. If this throws, the container is
+	// unchanged.
+	constexpr auto append(range auto && source) & -> void {
+		using traits = packed_traits<T>;
+		if constexpr (sized_range<decltype(source)>) {
+			auto const new_size = ::bounded::check_in_range<size_type>(
+				static_cast<std::size_t>(m_size) + static_cast<std::size_t>(::containers::size(source))
+			);
+			reserve(new_size);
+		}
+		if constexpr (element_bits == 0) {
+			auto count = std::size_t(0);
+			for (auto && value : source) {
+				static_cast<void>(value);
+				++count;
+			}
+			m_size = ::bounded::check_in_range<size_type>(static_cast<std::size_t>(m_size) + count);
+		} else {
+			auto const original_word_count = ::containers::size(m_words);
+			try {
+				auto count = std::size_t(0);
+				auto used = (static_cast<std::size_t>(m_size) * element_bits) % packed_word_bits;
+				// The partial last word is rewritten in place, with the bits of
+				// the existing elements unchanged, so there is nothing to
+				// restore in it if this throws.
+				auto replace_last = used != 0;
+				auto current = packed_word(0);
+				if (replace_last) {
+					// `pop_back` leaves the bits of removed elements behind
+					current = ::containers::back(m_words) & (shift_left(1, used) - 1U);
+				}
+				auto const store = [&] {
+					if (replace_last) {
+						::containers::back(m_words) = current;
+						replace_last = false;
+					} else {
+						::containers::push_back(m_words, current);
+					}
+				};
+				for (T const value : source) {
+					auto const encoded = traits::encode(value);
+					current |= shift_left(encoded, used);
+					used += element_bits;
+					if (used >= packed_word_bits) {
+						store();
+						used -= packed_word_bits;
+						current = shift_right(encoded, element_bits - used);
+					}
+					++count;
+				}
+				if (used != 0) {
+					store();
+				}
+				m_size = ::bounded::check_in_range<size_type>(static_cast<std::size_t>(m_size) + count);
+			} catch (...) {
+				while (::containers::size(m_words) != original_word_count) {
+					::containers::pop_back(m_words);
+				}
+				throw;
+			}
+		}
+	}
+
+	// Writes every element to `output`, reading each word once. Returns the end
+	// of the output.
+	constexpr auto unpack(::containers::iterator auto output) const {
+		using traits = packed_traits<T>;
+		auto const size = static_cast<std::size_t>(m_size);
+		if constexpr (element_bits == 0) {
+			for (std::size_t index = 0; index != size; ++index) {
+				*output = traits::decode(0);
+				++output;
+			}
+		} else {
+			auto const words = m_words.data();
+			auto current = size == 0 ? packed_word(0) : words[0];
+			auto available = packed_word_bits;
+			auto word_index = std::size_t(0);
+			for (std::size_t index = 0; index != size; ++index) {
+				auto encoded = current;
+				if (available >= element_bits) {
+					current = shift_right(current, element_bits);
+					available -= element_bits;
+				} else {
+					++word_index;
+					auto const next = words[word_index];
+					encoded |= shift_left(next, available);
+					current = shift_right(next, element_bits - available);
+					available += packed_word_bits - element_bits;
+				}
+				*output = traits::decode(encoded & traits::mask);
+				++output;
+			}
+		}
+		return output;
+	}
+
+	friend constexpr auto swap(packed_vector & lhs, packed_vector & rhs) noexcept -> void {
+		swap(lhs.m_words, rhs.m_words);
+		std::swap(lhs.m_size, rhs.m_size);
+	}
+
+private:
+	vector<packed_word> m_words;
+	size_type m_size = 0_bi;
+};
+
+} // namespace containers
@@ -0,0 +1,162 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+#include <operators/forward.hpp>
+
+export module containers.poly_vector;
+
+import containers.clear;
+import containers.data;
+import containers.maximum_array_size;
+import containers.pop_back;
+import containers.push_back;
+import containers.size;
+import containers.span;
+import containers.vector;
+
+import bounded;
+import std_module;
+import tv;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+template<typename T, typename... Ts>
+concept exactly_one_alternative = (0 + ... + int(std::same_as<std::decay_t<T>, Ts>)) == 1;
+
+template<typename... Ts>
+using poly_size_type = bounded::integer<0, bounded::normalize<(0_bi + ... + bounded::constant<maximum_array_size<Ts>>)>>;
+
+// Which alternative an element is, and where it is in that alternative's array
+template<typename... Ts>
+struct poly_order_entry {
+	bounded::integer<0, bounded::normalize<sizeof...(Ts) - 1U>> alternative;
+	bounded::integer<0, bounded::normalize<bounded::max(maximum_array_size<Ts>...)>> position;
+
+	friend auto operator==(poly_order_entry, poly_order_entry) -> bool = default;
+};
+
+struct no_order {
+	friend auto operator==(no_order, no_order) -> bool = default;
+};
+
+// Holds values of any of the types `Ts...`, like a vector of
+// `tv::variant<Ts...>`, but stores the values of each type in their own
+// contiguous array. Each element uses only the memory of its own type rather
+// than that of the largest type, and `for_each` runs a separate loop over each
+// array with no dispatch on the type of each element.
+//
+// If `keep_order` is true, the container also records the order in which the
+// elements were added, which costs one small entry per element, and
+// `for_each_in_order` visits the elements in that order.
+export template<bool keep_order, typename... Ts> requires(sizeof...(Ts) > 0)
+struct basic_poly_vector {
+	using size_type = poly_size_type<Ts...>;
+
+	constexpr basic_poly_vector() = default;
+
+	constexpr auto size() const -> size_type {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return (0_bi + ... + ::containers::size(m_arrays[indexes]));
+	}
+
+	// The elements of one type, in the order they were added
+	template<exactly_one_alternative<Ts...> T>
+	constexpr auto elements() const -> span<T const> {
+		return span<T const>(array_of<T>());
+	}
+	template<exactly_one_alternative<Ts...> T>
+	constexpr auto elements() -> span<T> {
+		return span<T>(array_of<T>());
+	}
+
+	template<exactly_one_alternative<Ts...> T>
+	constexpr auto push_back(T && value) & -> void {
+		using value_type = std::decay_t<T>;
+		auto & array = array_of<value_type>();
+		if constexpr (keep_order) {
+			::containers::push_back(m_order, poly_order_entry<Ts...>(
+				tv::get_index(bounded::type<value_type>, bounded::type<Ts>...),
+				::containers::size(array)
+			));
+			try {
+				::containers::push_back(array, OPERATORS_FORWARD(value));
+			} catch (...) {
+				::containers::pop_back(m_order);
+				throw;
+			}
+		} else {
+			::containers::push_back(array, OPERATORS_FORWARD(value));
+		}
+	}
+	constexpr auto push_back(tv::variant<Ts...> const & value) & -> void {
+		tv::visit(value, [&](auto const & alternative) { push_back(alternative); });
+	}
+	constexpr auto push_back(tv::variant<Ts...> && value) & -> void {
+		tv::visit(std::move(value), [&](auto && alternative) { push_back(std::move(alternative)); });
+	}
+
+	constexpr auto clear() & -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		(..., ::containers::clear(m_arrays[indexes]));
+		if constexpr (keep_order) {
+			::containers::clear(m_order);
+		}
+	}
+
+	// Calls `function` with every element, one type at a time. `function` must
+	// accept each of `Ts...`.
+	constexpr auto for_each(auto && function) const -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		(..., for_each_element(m_arrays[indexes], function));
+	}
+	constexpr auto for_each(auto && function) -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		(..., for_each_element(m_arrays[indexes], function));
+	}
+
+	// Calls `function` with every element in the order they were added. This
+	// has to find the type of each element, so it is slower than `for_each`.
+	constexpr auto for_each_in_order(auto && function) const -> void requires keep_order {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		for (auto const entry : m_order) {
+			auto const position = static_cast<std::size_t>(entry.position);
+			void((... or (entry.alternative == indexes and (void(function(::containers::data(m_arrays[indexes])[position])), true))));
+		}
+	}
+
+	friend constexpr auto operator==(basic_poly_vector const & lhs, basic_poly_vector const & rhs) -> bool = default;
+
+private:
+	template<typename T>
+	constexpr auto array_of() const -> vector<T> const & {
+		return m_arrays[bounded::type<vector<T>>];
+	}
+	template<typename T>
+	constexpr auto array_of() -> vector<T> & {
+		return m_arrays[bounded::type<vector<T>>];
+	}
+
+	static constexpr auto for_each_element(auto && array, auto & function) -> void {
+		for (auto && element : array) {
+			function(element);
+		}
+	}
+
+	tv::tuple<vector<Ts>...> m_arrays;
+	[[no_unique_address]] std::conditional_t<keep_order, vector<poly_order_entry<Ts...>>, no_order> m_order;
+};
+
+export template<typename... Ts>
+using poly_vector = basic_poly_vector<false, Ts...>;
+
+export template<typename... Ts>
+using ordered_poly_vector = basic_poly_vector<true, Ts...>;
+
+} // namespace containers
@@ -0,0 +1,255 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+#include <operators/arrow.hpp>
+#include <operators/bracket.hpp>
+#include <operators/forward.hpp>
+
+export module containers.segmented_vector;
+
+import containers.algorithms.destroy_range;
+import containers.array;
+import containers.assign_to_empty;
+import containers.begin_end;
+import containers.c_array;
+export import containers.common_iterator_functions;
+import containers.compare_container;
+import containers.initializer_range;
+import containers.maximum_array_size;
+import containers.range_value_t;
+import containers.span;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+constexpr auto first_segment_bits = std::size_t(4);
+constexpr auto first_segment_size = std::size_t(1) << first_segment_bits;
+
+constexpr auto segment_capacity(std::size_t const segment) -> std::size_t {
+	return first_segment_size << segment;
+}
+
+struct segment_position {
+	std::size_t segment;
+	std::size_t offset;
+};
+
+// Segment k holds `first_segment_size << k` elements, so the segments before it
+// hold `first_segment_size * (2^k - 1)`. Adding `first_segment_size` to an
+// index gives a number whose highest set bit is the segment and whose
+// remaining bits are the offset within it.
+constexpr auto segment_position_of(std::size_t const index) -> segment_position {
+	auto const biased = index + first_segment_size;
+	auto const segment = static_cast<std::size_t>(std::bit_width(biased)) - 1U - first_segment_bits;
+	return segment_position(segment, biased - segment_capacity(segment));
+}
+
+static_assert(segment_position_of(0).segment == 0 and segment_position_of(0).offset == 0);
+static_assert(segment_position_of(15).segment == 0 and segment_position_of(15).offset == 15);
+static_assert(segment_position_of(16).segment == 1 and segment_position_of(16).offset == 0);
+static_assert(segment_position_of(47).segment == 1 and segment_position_of(47).offset == 31);
+static_assert(segment_position_of(48).segment == 2 and segment_position_of(48).offset == 0);
+
+template<typename T>
+constexpr auto max_segments = segment_position_of(static_cast<std::size_t>(maximum_array_size<T>) - 1U).segment + 1U;
+
+template<typename T>
+struct segmented_vector_iterator {
+private:
+	using value_type = std::remove_const_t<T>;
+	static constexpr auto max_difference = bounded::normalize<maximum_array_size<value_type>>;
+public:
+	using difference_type = bounded::integer<bounded::normalize<-max_difference>, max_difference>;
+
+	segmented_vector_iterator() = default;
+	constexpr segmented_vector_iterator(value_type * const * const segments, std::size_t const index):
+		m_segments(segments),
+		m_index(index)
+	{
+	}
+
+	constexpr operator segmented_vector_iterator<T const>() const requires(!std::is_const_v<T>) {
+		return segmented_vector_iterator<T const>(m_segments, m_index);
+	}
+
+	constexpr auto operator*() const -> T & {
+		auto const position = ::containers::segment_position_of(m_index);
+		return m_segments[position.segment][position.offset];
+	}
+	OPERATORS_ARROW_DEFINITIONS
+
+	friend constexpr auto operator+(segmented_vector_iterator const it, difference_type const offset) -> segmented_vector_iterator {
+		return segmented_vector_iterator(
+			it.m_segments,
+			static_cast<std::size_t>(static_cast<std::ptrdiff_t>(it.m_index) + static_cast<std::ptrdiff_t>(offset))
+		);
+	}
+	friend constexpr auto operator-(segmented_vector_iterator const lhs, segmented_vector_iterator const rhs) -> difference_type {
+		return ::bounded::assume_in_range<difference_type>(
+			static_cast<std::ptrdiff_t>(lhs.m_index) - static_cast<std::ptrdiff_t>(rhs.m_index)
+		);
+	}
+	friend constexpr auto operator<=>(segmented_vector_iterator const lhs, segmented_vector_iterator const rhs) {
+		return lhs.m_index <=> rhs.m_index;
+	}
+	friend constexpr auto operator==(segmented_vector_iterator const lhs, segmented_vector_iterator const rhs) -> bool {
+		return lhs.m_index == rhs.m_index;
+	}
+
+private:
+	value_type * const * m_segments = nullptr;
+	std::size_t m_index = 0;
+};
+
+// A sequence that stores its elements in segments whose sizes double. Growing
+// allocates a new segment and never moves the existing elements, so
+// references to elements stay valid until they are removed, and growing never
+// needs memory for two copies of the elements. Indexing is O(1): the segment
+// is the position of the highest set bit of the index.
+//
+// Unlike the other containers, moving or swapping invalidates iterators,
+// because they point into the table of segments stored inside the container.
+// References and pointers to the elements stay valid.
+export template<typename T>
+struct segmented_vector : private lexicographical_comparison::base {
+	using size_type = array_size_type<T>;
+	using const_iterator = segmented_vector_iterator<T const>;
+	using iterator = segmented_vector_iterator<T>;
+
+	constexpr segmented_vector() = default;
+
+	constexpr explicit segmented_vector(constructor_initializer_range<segmented_vector> auto && source) {
+		::containers::assign_to_empty(*this, OPERATORS_FORWARD(source));
+	}
+
+	template<std::size_t source_size>
+	constexpr segmented_vector(c_array<T, source_size> && source) {
+		::containers::assign_to_empty(*this, std::move(source));
+	}
+	template<std::same_as<empty_c_array_parameter> Source = empty_c_array_parameter>
+	constexpr segmented_vector(Source) {
+	}
+
+	constexpr segmented_vector(segmented_vector && other) noexcept {
+		swap(*this, other);
+	}
+	constexpr segmented_vector(segmented_vector const & other) {
+		::containers::assign_to_empty(*this, other);
+	}
+
+	constexpr ~segmented_vector() noexcept {
+		clear();
+		for (std::size_t segment = 0; segment != m_allocated_segments; ++segment) {
+			std::allocator<T>().deallocate(m_segments[segment], segment_capacity(segment));
+		}
+	}
+
+	constexpr auto operator=(segmented_vector && other) & noexcept -> segmented_vector & {
+		swap(*this, other);
+		return *this;
+	}
+	constexpr auto operator=(segmented_vector const & other) & -> segmented_vector & {
+		if (this != std::addressof(other)) {
+			auto temp = other;
+			swap(*this, temp);
+		}
+		return *this;
+	}
+
+	friend constexpr auto swap(segmented_vector & lhs, segmented_vector & rhs) noexcept -> void {
+		std::swap(lhs.m_segments, rhs.m_segments);
+		std::swap(lhs.m_allocated_segments, rhs.m_allocated_segments);
+		std::swap(lhs.m_size, rhs.m_size);
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(m_segments.data(), 0);
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(m_segments.data(), 0);
+	}
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+	OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS
+
+	constexpr auto capacity() const -> size_type {
+		auto const allocated = first_segment_size * ((std::size_t(1) << m_allocated_segments) - 1U);
+		return ::bounded::assume_in_range<size_type>(std::min(allocated, static_cast<std::size_t>(maximum_array_size<T>)));
+	}
+	// Allocates segments until there is room for `new_capacity` elements
+	constexpr auto reserve(size_type const new_capacity) -> void {
+		while (capacity() < new_capacity) {
+			allocate_segment();
+		}
+	}
+
+	// The elements are contiguous within each segment. Iterating over the
+	// segments and then over each span avoids computing the position of each
+	// element.
+	constexpr auto segment_count() const -> std::size_t {
+		return m_size == 0_bi ? 0U : ::containers::segment_position_of(static_cast<std::size_t>(m_size) - 1U).segment + 1U;
+	}
+	constexpr auto segment(std::size_t const index) const {
+		BOUNDED_ASSERT(index < segment_count());
+		return span<T const>(m_segments[index], ::bounded::assume_in_range<array_size_type<T>>(segment_size(index)));
+	}
+	constexpr auto segment(std::size_t const index) {
+		BOUNDED_ASSERT(index < segment_count());
+		return span<T>(m_segments[index], ::bounded::assume_in_range<array_size_type<T>>(segment_size(index)));
+	}
+
+	constexpr auto lazy_push_back(bounded::construct_function_for<T> auto && constructor) & -> T & {
+		auto const position = ::containers::segment_position_of(static_cast<std::size_t>(m_size));
+		if (position.segment == m_allocated_segments) {
+			allocate_segment();
+		}
+		auto & element = m_segments[position.segment][position.offset];
+		bounded::construct_at(element, OPERATORS_FORWARD(constructor));
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		return element;
+	}
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		auto const position = ::containers::segment_position_of(static_cast<std::size_t>(m_size) - 1U);
+		bounded::destroy(m_segments[position.segment][position.offset]);
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+	}
+	// Keeps the allocated segments
+	constexpr auto clear() & -> void {
+		for (std::size_t index = 0; index != segment_count(); ++index) {
+			::containers::destroy_range(segment(index));
+		}
+		m_size = 0_bi;
+	}
+
+private:
+	constexpr auto allocate_segment() -> void {
+		BOUNDED_ASSERT(m_allocated_segments != max_segments<T>);
+		m_segments[m_allocated_segments] = std::allocator<T>().allocate(segment_capacity(m_allocated_segments));
+		++m_allocated_segments;
+	}
+	constexpr auto segment_size(std::size_t const index) const -> std::size_t {
+		auto const last = ::containers::segment_position_of(static_cast<std::size_t>(m_size) - 1U);
+		return index == last.segment ? last.offset + 1U : segment_capacity(index);
+	}
+
+	array<T *, bounded::constant<max_segments<T>>> m_segments{};
+	std::size_t m_allocated_segments = 0;
+	size_type m_size = 0_bi;
+};
+
+template<typename Range>
+segmented_vector(Range &&) -> segmented_vector<std::decay_t<range_value_t<Range>>>;
+
+} // namespace containers
@@ -0,0 +1,209 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+#include <operators/forward.hpp>
+
+export module containers.slot_map;
+
+import containers.begin_end;
+import containers.lazy_push_back;
+import containers.maximum_array_size;
+import containers.pop_back;
+import containers.push_back;
+import containers.size;
+import containers.vector;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// Identifies an element of a slot_map. The index of the slot and the
+// generation of the slot are packed into 64 bits: the index gets exactly as
+// many bits as a slot_map of `max_size` elements needs, and the generation
+// gets the rest.
+export template<array_size_type<std::byte> max_size> requires(max_size > 0_bi)
+struct slot_map_key {
+private:
+	static constexpr auto index_bits = static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(max_size - 1_bi)));
+public:
+	using index_type = bounded::integer<0, bounded::normalize<max_size - 1_bi>>;
+	using generation_type = bounded::integer<0, bounded::normalize<(numeric_traits::max_value<std::uint64_t> >> index_bits)>>;
+
+	constexpr slot_map_key(index_type const index_, generation_type const generation_):
+		m_value(static_cast<std::uint64_t>(index_) | (static_cast<std::uint64_t>(generation_) << index_bits))
+	{
+	}
+
+	constexpr auto index() const -> index_type {
+		return ::bounded::assume_in_range<index_type>(m_value & ((std::uint64_t(1) << index_bits) - 1U));
+	}
+	constexpr auto generation() const -> generation_type {
+		return ::bounded::assume_in_range<generation_type>(m_value >> index_bits);
+	}
+
+	friend auto operator<=>(slot_map_key, slot_map_key) = default;
+
+private:
+	std::uint64_t m_value;
+};
+
+template<typename T>
+constexpr auto default_slot_map_size = array_size_type<std::byte>(bounded::min(
+	bounded::constant<numeric_traits::max_value<std::uint32_t>>,
+	bounded::constant<maximum_array_size<T>>
+));
+
+// Stores values in a contiguous array, and gives out keys that stay valid
+// until that value is erased. Insert, erase and lookup are O(1).
+//
+// Each key names a slot, and each slot records the position of its value in the
+// array. Erasing a value moves the last value into its place and updates that
+// value's slot, so the values never have gaps. Erased slots go on a free list
+// to be reused, and each slot has a generation that changes whenever its value
+// is erased, so a key to an erased value never finds the value that reused its
+// slot. The generation of a slot is odd while it holds a value.
+export template<typename T, array_size_type<std::byte> max_size = default_slot_map_size<T>>
+struct slot_map {
+	using key_type = slot_map_key<max_size>;
+	using size_type = bounded::integer<0, bounded::normalize<max_size>>;
+
+	constexpr slot_map() = default;
+
+	// Iterates over the values, in no particular order
+	constexpr auto begin() const {
+		return ::containers::begin(m_values);
+	}
+	constexpr auto begin() {
+		return ::containers::begin(m_values);
+	}
+	constexpr auto size() const -> size_type {
+		return ::containers::size(m_values);
+	}
+
+	// The key of the value at `position` in the iteration order
+	constexpr auto key_at(size_type const position) const -> key_type {
+		BOUNDED_ASSERT(position < size());
+		auto const index = m_value_slots[::bounded::assume_in_range<index_type>(position)];
+		return key_type(index, m_slots[index].generation);
+	}
+
+	constexpr auto lazy_insert(bounded::construct_function_for<T> auto && constructor) & -> key_type {
+		if (::containers::size(m_slots) == ::containers::size(m_values)) {
+			::containers::push_back(m_slots, slot_t(0_bi, m_free_head));
+			m_free_head = ::bounded::assume_in_range<index_type>(::containers::size(m_slots) - 1_bi);
+		}
+		auto const index = m_free_head;
+		::containers::push_back(m_value_slots, index);
+		try {
+			::containers::lazy_push_back(m_values, OPERATORS_FORWARD(constructor));
+		} catch (...) {
+			::containers::pop_back(m_value_slots);
+			throw;
+		}
+		auto & slot = m_slots[index];
+		m_free_head = slot.target;
+		slot.generation = next_generation(slot.generation);
+		slot.target = ::bounded::assume_in_range<index_type>(size() - 1_bi);
+		return key_type(index, slot.generation);
+	}
+	constexpr auto insert(T const & value) & -> key_type {
+		return lazy_insert(bounded::value_to_function(value));
+	}
+	constexpr auto insert(T && value) & -> key_type {
+		return lazy_insert(bounded::value_to_function(std::move(value)));
+	}
+
+	// Returns whether there was a value for `key`
+	constexpr auto erase(key_type const key) & -> bool {
+		auto const slot = occupied_slot(key);
+		if (!slot) {
+			return false;
+		}
+		auto const position = slot->target;
+		auto const last = ::bounded::assume_in_range<index_type>(size() - 1_bi);
+		if (position != last) {
+			m_values[position] = std::move(m_values[last]);
+			m_value_slots[position] = m_value_slots[last];
+			m_slots[m_value_slots[position]].target = position;
+		}
+		::containers::pop_back(m_values);
+		::containers::pop_back(m_value_slots);
+		free_slot(key.index());
+		return true;
+	}
+	// Keys to the erased values stay invalid
+	constexpr auto clear() & -> void {
+		while (size() != 0_bi) {
+			free_slot(m_value_slots[::bounded::assume_in_range<index_type>(size() - 1_bi)]);
+			::containers::pop_back(m_values);
+			::containers::pop_back(m_value_slots);
+		}
+	}
+
+	// Returns nullptr if the value for `key` has been erased
+	constexpr auto lookup(key_type const key) const -> T const * {
+		auto const slot = occupied_slot(key);
+		return slot ? std::addressof(m_values[slot->target]) : nullptr;
+	}
+	constexpr auto lookup(key_type const key) -> T * {
+		auto const slot = occupied_slot(key);
+		return slot ? std::addressof(m_values[slot->target]) : nullptr;
+	}
+	constexpr auto contains(key_type const key) const -> bool {
+		return occupied_slot(key) != nullptr;
+	}
+
+private:
+	using index_type = typename key_type::index_type;
+	using generation_type = typename key_type::generation_type;
+
+	struct slot_t {
+		generation_type generation;
+		// The position of the value if this slot is in use, otherwise the next
+		// slot in the free list
+		index_type target;
+	};
+
+	static constexpr auto next_generation(generation_type const generation) -> generation_type {
+		return generation == numeric_traits::max_value<generation_type> ?
+			generation_type(0_bi) :
+			::bounded::assume_in_range<generation_type>(generation + 1_bi);
+	}
+
+	constexpr auto occupied_slot(key_type const key) const -> slot_t const * {
+		auto const index = key.index();
+		if (index >= ::containers::size(m_slots)) {
+			return nullptr;
+		}
+		auto const & result = m_slots[index];
+		if (result.generation != key.generation() or result.generation % 2_bi == 0_bi) {
+			return nullptr;
+		}
+		return std::addressof(result);
+	}
+
+	constexpr auto free_slot(index_type const index) -> void {
+		auto & slot = m_slots[index];
+		slot.generation = next_generation(slot.generation);
+		slot.target = m_free_head;
+		m_free_head = index;
+	}
+
+	vector<T, max_size> m_values;
+	// The slot of each value
+	vector<index_type, max_size> m_value_slots;
+	vector<slot_t, max_size> m_slots;
+	// Only meaningful if there are more slots than values
+	index_type m_free_head = 0_bi;
+};
+
+} // namespace containers
@@ -0,0 +1,260 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+#include <operators/forward.hpp>
+
+export module containers.soa_flat_map;
+
+import containers.algorithms.sort.auto_sort;
+import containers.algorithms.sort.is_sorted;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.algorithms.binary_search;
+import containers.algorithms.erase;
+import containers.begin_end;
+import containers.extract_key_to_less;
+import containers.index_type;
+import containers.insert;
+import containers.iter_difference_t;
+import containers.iterator_t;
+import containers.map_tags;
+import containers.map_value_type;
+import containers.push_back;
+import containers.range;
+import containers.range_size_t;
+import containers.range_value_t;
+import containers.size;
+export import containers.soa_map_iterator;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+template<typename Container>
+constexpr auto element_at(Container && container, std::size_t const index) -> decltype(auto) {
+	return OPERATORS_FORWARD(container)[::bounded::assume_in_range<index_type<Container>>(index)];
+}
+
+// A sorted map that stores the keys and the mapped values in two parallel
+// containers. Searches touch only the keys, so lookups stay cache friendly
+// even when the mapped values are large. Sorting orders a permutation of
+// indexes by key and then moves each key and mapped value once, so large
+// mapped values are never swapped during the sort.
+export template<typename KeyContainer, typename MappedContainer, typename ExtractKey = to_radix_sort_key_t>
+class basic_soa_flat_map {
+public:
+	using key_type = range_value_t<KeyContainer>;
+	using mapped_type = range_value_t<MappedContainer>;
+
+	using const_iterator = soa_map_iterator<iterator_t<KeyContainer const &>, iterator_t<MappedContainer const &>>;
+	using iterator = soa_map_iterator<iterator_t<KeyContainer const &>, iterator_t<MappedContainer &>>;
+
+	constexpr auto compare() const {
+		return ::containers::extract_key_to_less(m_extract_key);
+	}
+
+	basic_soa_flat_map() = default;
+	constexpr explicit basic_soa_flat_map(ExtractKey extract_key):
+		m_extract_key(std::move(extract_key))
+	{
+	}
+
+	// `source` is a range of anything that works with `get_key` and
+	// `get_mapped`. Only the first of each group of equivalent keys is kept.
+	template<range Source> requires(!std::same_as<std::remove_cvref_t<Source>, basic_soa_flat_map>)
+	constexpr basic_soa_flat_map(Source && source, ExtractKey extract_key):
+		m_extract_key(std::move(extract_key))
+	{
+		insert(OPERATORS_FORWARD(source));
+	}
+	template<range Source> requires(!std::same_as<std::remove_cvref_t<Source>, basic_soa_flat_map>)
+	constexpr explicit basic_soa_flat_map(Source && source):
+		basic_soa_flat_map(OPERATORS_FORWARD(source), ExtractKey())
+	{
+	}
+
+	constexpr basic_soa_flat_map(assume_sorted_unique_t, KeyContainer keys, MappedContainer values, ExtractKey extract_key = ExtractKey()):
+		m_keys(std::move(keys)),
+		m_values(std::move(values)),
+		m_extract_key(std::move(extract_key))
+	{
+		BOUNDED_ASSERT(containers::size(m_keys) == containers::size(m_values));
+		BOUNDED_ASSERT(is_sorted(m_keys, compare()));
+	}
+
+	constexpr auto keys() const -> KeyContainer const & {
+		return m_keys;
+	}
+	constexpr auto values() const -> MappedContainer const & {
+		return m_values;
+	}
+	constexpr auto values() -> MappedContainer & {
+		return m_values;
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(::containers::begin(m_keys), ::containers::begin(m_values));
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(::containers::begin(std::as_const(m_keys)), ::containers::begin(m_values));
+	}
+	constexpr auto size() const {
+		return ::containers::size(m_keys);
+	}
+
+	constexpr auto reserve(range_size_t<KeyContainer> const new_capacity) -> void {
+		m_keys.reserve(new_capacity);
+		m_values.reserve(::bounded::assume_in_range<range_size_t<MappedContainer>>(new_capacity));
+	}
+
+	constexpr auto find(key_type const & key) const -> const_iterator {
+		return const_iterator_at(position_of(key));
+	}
+	constexpr auto find(key_type const & key) -> iterator {
+		return iterator_at(position_of(key));
+	}
+
+	constexpr auto lazy_insert(auto && key, bounded::construct_function_for<mapped_type> auto && mapped) {
+		auto const key_position = ::containers::upper_bound(m_keys, key, compare());
+		auto const index = static_cast<std::size_t>(key_position - ::containers::begin(m_keys));
+		if (index != 0 and !compare()(::containers::element_at(m_keys, index - 1), key)) {
+			return inserted_t{iterator_at(index - 1), false};
+		}
+		::containers::lazy_insert(m_keys, key_position, [&] { return key_type(OPERATORS_FORWARD(key)); });
+		try {
+			::containers::lazy_insert(m_values, value_position(index), OPERATORS_FORWARD(mapped));
+		} catch (...) {
+			::containers::erase(m_keys, key_position_at(index));
+			throw;
+		}
+		return inserted_t{iterator_at(index), true};
+	}
+
+	// Appends the new elements and sorts their indexes by key. Each new key
+	// that is not already in the map is then moved once more, in sorted order,
+	// past the end of the appended elements, and that sorted run is merged
+	// backward into place. The only temporary is the vector of indexes. If a
+	// key is already in the map, the existing element is kept.
+	constexpr auto insert(range auto && source) -> void {
+		auto const existing_size = static_cast<std::size_t>(containers::size(m_keys));
+		try {
+			for (auto && value : source) {
+				::containers::push_back(m_keys, std::forward_like<decltype(value)>(get_key(value)));
+				::containers::push_back(m_values, std::forward_like<decltype(value)>(get_mapped(value)));
+			}
+		} catch (...) {
+			::containers::erase_to_end(m_keys, key_position_at(existing_size));
+			::containers::erase_to_end(m_values, value_position(existing_size));
+			throw;
+		}
+		auto const appended_size = static_cast<std::size_t>(containers::size(m_keys));
+		auto const batch_size = appended_size - existing_size;
+		if (batch_size == 0) {
+			return;
+		}
+		auto order = vector<std::size_t>();
+		order.reserve(::bounded::assume_in_range<range_size_t<vector<std::size_t>>>(batch_size));
+		for (std::size_t index = existing_size; index != appended_size; ++index) {
+			::containers::push_back(order, index);
+		}
+		// Equivalent keys are ordered by their position in `source`, so the
+		// first of them is the one that is kept
+		::containers::auto_sort(order, [&](std::size_t const lhs, std::size_t const rhs) {
+			auto const & lhs_key = ::containers::element_at(m_keys, lhs);
+			auto const & rhs_key = ::containers::element_at(m_keys, rhs);
+			return compare()(lhs_key, rhs_key) or (!compare()(rhs_key, lhs_key) and lhs < rhs);
+		});
+		// Moving an element of a container into itself must not reallocate
+		reserve(::bounded::check_in_range<range_size_t<KeyContainer>>(appended_size + batch_size));
+
+		std::size_t existing_position = 0;
+		for (std::size_t position = 0; position != batch_size; ) {
+			auto const index = ::containers::element_at(order, position);
+			auto const & key = ::containers::element_at(m_keys, index);
+			// Skips the rest of the new elements with the same key before this
+			// one is moved from
+			++position;
+			while (position != batch_size and !compare()(key, ::containers::element_at(m_keys, ::containers::element_at(order, position)))) {
+				++position;
+			}
+			while (existing_position != existing_size and compare()(::containers::element_at(m_keys, existing_position), key)) {
+				++existing_position;
+			}
+			if (existing_position == existing_size or compare()(key, ::containers::element_at(m_keys, existing_position))) {
+				::containers::push_back(m_keys, std::move(::containers::element_at(m_keys, index)));
+				::containers::push_back(m_values, std::move(::containers::element_at(m_values, index)));
+			}
+		}
+
+		auto const move_element = [&](std::size_t const from, std::size_t const to) {
+			::containers::element_at(m_keys, to) = std::move(::containers::element_at(m_keys, from));
+			::containers::element_at(m_values, to) = std::move(::containers::element_at(m_values, from));
+		};
+		auto const added_size = static_cast<std::size_t>(containers::size(m_keys)) - appended_size;
+		auto target = existing_size + added_size;
+		auto remaining_existing = existing_size;
+		auto remaining_added = added_size;
+		while (remaining_added != 0) {
+			--target;
+			auto const & added = ::containers::element_at(m_keys, appended_size + remaining_added - 1);
+			if (remaining_existing != 0 and compare()(added, ::containers::element_at(m_keys, remaining_existing - 1))) {
+				--remaining_existing;
+				move_element(remaining_existing, target);
+			} else {
+				--remaining_added;
+				move_element(appended_size + remaining_added, target);
+			}
+		}
+		::containers::erase_to_end(m_keys, key_position_at(existing_size + added_size));
+		::containers::erase_to_end(m_values, value_position(existing_size + added_size));
+	}
+
+	constexpr auto erase(const_iterator const it) -> iterator {
+		auto const index = static_cast<std::size_t>(it.key_iterator() - ::containers::begin(m_keys));
+		::containers::erase(m_keys, key_position_at(index));
+		::containers::erase(m_values, value_position(index));
+		return iterator_at(index);
+	}
+
+	friend constexpr auto operator==(basic_soa_flat_map const & lhs, basic_soa_flat_map const & rhs) -> bool {
+		return lhs.m_keys == rhs.m_keys and lhs.m_values == rhs.m_values;
+	}
+
+private:
+	// Returns `size()` if `key` is not in the map
+	constexpr auto position_of(key_type const & key) const -> std::size_t {
+		auto const it = ::containers::lower_bound(m_keys, key, compare());
+		auto const index = static_cast<std::size_t>(it - ::containers::begin(m_keys));
+		return (it == ::containers::end(m_keys) or compare()(key, *it)) ?
+			static_cast<std::size_t>(containers::size(m_keys)) :
+			index;
+	}
+	constexpr auto key_position_at(std::size_t const index) const {
+		return ::containers::begin(m_keys) + ::bounded::assume_in_range<iter_difference_t<iterator_t<KeyContainer const &>>>(index);
+	}
+	constexpr auto value_position(std::size_t const index) const {
+		return ::containers::begin(m_values) + ::bounded::assume_in_range<iter_difference_t<iterator_t<MappedContainer const &>>>(index);
+	}
+	constexpr auto const_iterator_at(std::size_t const index) const -> const_iterator {
+		return begin() + ::bounded::assume_in_range<typename const_iterator::difference_type>(index);
+	}
+	constexpr auto iterator_at(std::size_t const index) -> iterator {
+		return begin() + ::bounded::assume_in_range<typename iterator::difference_type>(index);
+	}
+
+	KeyContainer m_keys;
+	MappedContainer m_values;
+	[[no_unique_address]] ExtractKey m_extract_key;
+};
+
+export template<typename Key, typename Mapped, typename ExtractKey = to_radix_sort_key_t>
+using soa_flat_map = basic_soa_flat_map<vector<Key>, vector<Mapped>, ExtractKey>;
+
+} // namespace containers
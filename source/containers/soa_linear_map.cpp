@@ -0,0 +1,213 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+#include <operators/forward.hpp>
+
+export module containers.soa_linear_map;
+
+import containers.algorithms.advance;
+import containers.algorithms.erase;
+import containers.algorithms.find;
+import containers.begin_end;
+import containers.contiguous_range;
+import containers.data;
+import containers.iter_difference_t;
+import containers.iterator_t;
+import containers.lazy_push_back;
+import containers.map_tags;
+import containers.map_value_type;
+import containers.range;
+import containers.range_size_t;
+import containers.range_value_t;
+import containers.size;
+export import containers.soa_map_iterator;
+import containers.static_vector;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+// Enough keys to fill a cache line, and few enough that the matches fit in a
+// 32-bit mask
+template<typename Key>
+constexpr auto key_block_size = std::clamp(64 / sizeof(Key), std::size_t(8), std::size_t(32));
+
+// Compares a whole block of keys before looking at any of the results. There
+// is no branch on each comparison, so the compiler turns each block into a few
+// vector compares and a mask test.
+template<typename Key>
+constexpr auto block_find_key(Key const * const keys, std::size_t const size, Key const & key) -> std::size_t {
+	constexpr auto block_size = key_block_size<Key>;
+	std::size_t index = 0;
+	for (; index + block_size <= size; index += block_size) {
+		std::uint32_t matches = 0;
+		for (std::size_t offset = 0; offset != block_size; ++offset) {
+			matches |= static_cast<std::uint32_t>(keys[index + offset] == key) << offset;
+		}
+		if (matches != 0) {
+			return index + static_cast<std::size_t>(std::countr_zero(matches));
+		}
+	}
+	for (; index != size; ++index) {
+		if (keys[index] == key) {
+			return index;
+		}
+	}
+	return size;
+}
+
+template<typename KeyContainer, typename Equal>
+concept block_searchable_keys =
+	contiguous_range<KeyContainer> and
+	bounded::isomorphic_to_integral<range_value_t<KeyContainer>> and
+	std::same_as<Equal, std::equal_to<>>;
+
+// A linear_map that stores the keys and the mapped values in two parallel
+// containers. For integer keys, `find` compares a block of keys at a time,
+// which keeps this faster than a flat_map up to a much larger size.
+export template<typename KeyContainer, typename MappedContainer, typename Equal = std::equal_to<>>
+class basic_soa_linear_map {
+public:
+	using key_type = range_value_t<KeyContainer>;
+	using mapped_type = range_value_t<MappedContainer>;
+
+	using const_iterator = soa_map_iterator<iterator_t<KeyContainer const &>, iterator_t<MappedContainer const &>>;
+	using iterator = soa_map_iterator<iterator_t<KeyContainer const &>, iterator_t<MappedContainer &>>;
+
+	constexpr auto equal() const {
+		return m_equal;
+	}
+
+	basic_soa_linear_map() = default;
+	constexpr explicit basic_soa_linear_map(Equal equal_):
+		m_equal(std::move(equal_))
+	{
+	}
+
+	// `source` is a range of anything that works with `get_key` and
+	// `get_mapped`. Only the first of each group of equal keys is kept.
+	template<range Source> requires(!std::same_as<std::remove_cvref_t<Source>, basic_soa_linear_map>)
+	constexpr basic_soa_linear_map(Source && source, Equal equal_):
+		m_equal(std::move(equal_))
+	{
+		insert(OPERATORS_FORWARD(source));
+	}
+	template<range Source> requires(!std::same_as<std::remove_cvref_t<Source>, basic_soa_linear_map>)
+	constexpr explicit basic_soa_linear_map(Source && source):
+		basic_soa_linear_map(OPERATORS_FORWARD(source), Equal())
+	{
+	}
+
+	constexpr basic_soa_linear_map(assume_unique_t, KeyContainer keys, MappedContainer values, Equal equal_ = Equal()):
+		m_keys(std::move(keys)),
+		m_values(std::move(values)),
+		m_equal(std::move(equal_))
+	{
+		BOUNDED_ASSERT(containers::size(m_keys) == containers::size(m_values));
+	}
+
+	constexpr auto keys() const -> KeyContainer const & {
+		return m_keys;
+	}
+	constexpr auto values() const -> MappedContainer const & {
+		return m_values;
+	}
+	constexpr auto values() -> MappedContainer & {
+		return m_values;
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(::containers::begin(m_keys), ::containers::begin(m_values));
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(::containers::begin(std::as_const(m_keys)), ::containers::begin(m_values));
+	}
+	constexpr auto size() const {
+		return ::containers::size(m_keys);
+	}
+
+	constexpr auto reserve(range_size_t<KeyContainer> const new_capacity) -> void {
+		m_keys.reserve(new_capacity);
+		m_values.reserve(::bounded::assume_in_range<range_size_t<MappedContainer>>(new_capacity));
+	}
+
+	// O(n) time
+	constexpr auto find(key_type const & key) const -> const_iterator {
+		return begin() + offset(index_of(key));
+	}
+	// O(n) time
+	constexpr auto find(key_type const & key) -> iterator {
+		return begin() + offset(index_of(key));
+	}
+
+	// O(n) time
+	constexpr auto lazy_insert(auto && key, bounded::construct_function_for<mapped_type> auto && mapped) {
+		auto const index = index_of(key);
+		if (index != static_cast<std::size_t>(size())) {
+			return inserted_t{begin() + offset(index), false};
+		}
+		::containers::lazy_push_back(m_keys, [&] { return key_type(OPERATORS_FORWARD(key)); });
+		try {
+			::containers::lazy_push_back(m_values, OPERATORS_FORWARD(mapped));
+		} catch (...) {
+			::containers::erase(m_keys, containers::prev(::containers::end(m_keys)));
+			throw;
+		}
+		return inserted_t{begin() + offset(index), true};
+	}
+
+	// O(n * m) time
+	constexpr auto insert(range auto && source) -> void {
+		for (auto && value : source) {
+			lazy_insert(
+				std::forward_like<decltype(value)>(get_key(value)),
+				[&] { return mapped_type(std::forward_like<decltype(value)>(get_mapped(value))); }
+			);
+		}
+	}
+
+	constexpr auto erase(const_iterator const it) -> iterator {
+		auto const index = it.key_iterator() - ::containers::begin(m_keys);
+		::containers::erase(m_keys, it.key_iterator());
+		::containers::erase(m_values, ::containers::begin(m_values) + ::bounded::assume_in_range<iter_difference_t<iterator_t<MappedContainer const &>>>(index));
+		return begin() + index;
+	}
+
+	friend constexpr auto operator==(basic_soa_linear_map const & lhs, basic_soa_linear_map const & rhs) -> bool {
+		return lhs.m_keys == rhs.m_keys and lhs.m_values == rhs.m_values;
+	}
+
+private:
+	static constexpr auto offset(std::size_t const index) {
+		return ::bounded::assume_in_range<iter_difference_t<iterator_t<KeyContainer const &>>>(index);
+	}
+
+	// Returns `size()` if `key` is not in the map
+	constexpr auto index_of(key_type const & key) const -> std::size_t {
+		if constexpr (block_searchable_keys<KeyContainer, Equal>) {
+			return ::containers::block_find_key(::containers::data(m_keys), static_cast<std::size_t>(size()), key);
+		} else {
+			auto const it = ::containers::find_if(m_keys, [&](key_type const & element) { return m_equal(key, element); });
+			return static_cast<std::size_t>(it - ::containers::begin(m_keys));
+		}
+	}
+
+	KeyContainer m_keys;
+	MappedContainer m_values;
+	[[no_unique_address]] Equal m_equal;
+};
+
+export template<typename Key, typename T, typename... MaybeEqual>
+using soa_linear_map = basic_soa_linear_map<vector<Key>, vector<T>, MaybeEqual...>;
+
+export template<typename Key, typename T, std::size_t capacity, typename... MaybeEqual>
+using static_soa_linear_map = basic_soa_linear_map<static_vector<Key, bounded::constant<capacity>>, static_vector<T, bounded::constant<capacity>>, MaybeEqual...>;
+
+} // namespace containers
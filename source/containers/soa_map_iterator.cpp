@@ -0,0 +1,69 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.soa_map_iterator;
+
+export import containers.common_iterator_functions;
+import containers.iter_difference_t;
+import containers.iter_reference_t;
+import containers.map_value_type;
+
+import bounded;
+import std_module;
+
+namespace containers {
+
+// Walks the keys and the mapped values together. Dereferencing produces a
+// `map_value_type` of references, so `get_key` and `get_mapped` work the same
+// as they do for other maps.
+export template<typename KeyIterator, typename MappedIterator>
+struct soa_map_iterator {
+	using difference_type = iter_difference_t<KeyIterator>;
+
+	soa_map_iterator() = default;
+	constexpr soa_map_iterator(KeyIterator const key, MappedIterator const mapped):
+		m_key(key),
+		m_mapped(mapped)
+	{
+	}
+	template<typename OtherMapped> requires bounded::convertible_to<MappedIterator, OtherMapped>
+	constexpr operator soa_map_iterator<KeyIterator, OtherMapped>() const {
+		return soa_map_iterator<KeyIterator, OtherMapped>(m_key, m_mapped);
+	}
+
+	constexpr auto key_iterator() const -> KeyIterator {
+		return m_key;
+	}
+	constexpr auto mapped_iterator() const -> MappedIterator {
+		return m_mapped;
+	}
+
+	constexpr auto operator*() const {
+		using reference = map_value_type<iter_reference_t<KeyIterator>, iter_reference_t<MappedIterator>>;
+		return reference{*m_key, *m_mapped};
+	}
+
+	friend constexpr auto operator+(soa_map_iterator const lhs, difference_type const offset) -> soa_map_iterator {
+		return soa_map_iterator(
+			lhs.m_key + offset,
+			lhs.m_mapped + ::bounded::assume_in_range<iter_difference_t<MappedIterator>>(offset)
+		);
+	}
+	friend constexpr auto operator-(soa_map_iterator const lhs, soa_map_iterator const rhs) {
+		return lhs.m_key - rhs.m_key;
+	}
+	friend constexpr auto operator<=>(soa_map_iterator const lhs, soa_map_iterator const rhs) {
+		return lhs.m_key <=> rhs.m_key;
+	}
+	friend constexpr auto operator==(soa_map_iterator const lhs, soa_map_iterator const rhs) -> bool {
+		return lhs.m_key == rhs.m_key;
+	}
+
+private:
+	KeyIterator m_key;
+	MappedIterator m_mapped;
+};
+
+} // namespace containers
@@ -0,0 +1,274 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+#include <operators/forward.hpp>
+
+export module containers.soa_vector;
+
+import containers.algorithms.compare;
+import containers.algorithms.uninitialized;
+export import containers.common_iterator_functions;
+import containers.maximum_array_size;
+import containers.range;
+import containers.reallocation_size;
+import containers.span;
+import containers.uninitialized_dynamic_array;
+
+import bounded;
+import numeric_traits;
+import std_module;
+import tv;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+template<typename... Ts>
+using soa_size_type = bounded::integer<0, bounded::normalize<bounded::min(maximum_array_size<std::remove_const_t<Ts>>...)>>;
+
+// Walks all of the columns together. Dereferencing produces a `tv::tuple` of
+// references to the fields of one row.
+template<typename... Ts>
+struct soa_vector_iterator {
+private:
+	static constexpr auto max_difference = bounded::normalize<numeric_traits::max_value<soa_size_type<Ts...>>>;
+public:
+	using difference_type = bounded::integer<bounded::normalize<-max_difference>, max_difference>;
+
+	soa_vector_iterator() = default;
+	constexpr soa_vector_iterator(tv::tuple<Ts *...> const columns, std::size_t const index):
+		m_columns(columns),
+		m_index(index)
+	{
+	}
+
+	constexpr operator soa_vector_iterator<Ts const...>() const requires(!(... and std::is_const_v<Ts>)) {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return soa_vector_iterator<Ts const...>(tv::tuple<Ts const *...>(m_columns[indexes]...), m_index);
+	}
+
+	constexpr auto operator*() const -> tv::tuple<Ts &...> {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return tv::tie(m_columns[indexes][m_index]...);
+	}
+
+	friend constexpr auto operator+(soa_vector_iterator const it, difference_type const offset) -> soa_vector_iterator {
+		return soa_vector_iterator(
+			it.m_columns,
+			static_cast<std::size_t>(static_cast<std::ptrdiff_t>(it.m_index) + static_cast<std::ptrdiff_t>(offset))
+		);
+	}
+	friend constexpr auto operator-(soa_vector_iterator const lhs, soa_vector_iterator const rhs) -> difference_type {
+		return ::bounded::assume_in_range<difference_type>(
+			static_cast<std::ptrdiff_t>(lhs.m_index) - static_cast<std::ptrdiff_t>(rhs.m_index)
+		);
+	}
+	friend constexpr auto operator<=>(soa_vector_iterator const lhs, soa_vector_iterator const rhs) {
+		return lhs.m_index <=> rhs.m_index;
+	}
+	friend constexpr auto operator==(soa_vector_iterator const lhs, soa_vector_iterator const rhs) -> bool {
+		return lhs.m_index == rhs.m_index;
+	}
+
+private:
+	tv::tuple<Ts *...> m_columns;
+	std::size_t m_index = 0;
+};
+
+// A sequence of records of type `tv::tuple<Ts...>` that stores each field in
+// its own contiguous array. The columns share one size and one capacity. A
+// loop that only reads a few fields of each record uses `column` and reads
+// only those arrays, rather than loading whole records into the cache.
+//
+// Iterating over the container itself visits rows: each element is a
+// `tv::tuple` of references to the fields.
+export template<typename... Ts> requires(sizeof...(Ts) > 0)
+struct soa_vector {
+	using value_type = tv::tuple<Ts...>;
+	using size_type = soa_size_type<Ts...>;
+	using const_iterator = soa_vector_iterator<Ts const...>;
+	using iterator = soa_vector_iterator<Ts...>;
+
+	constexpr soa_vector() = default;
+
+	// `source` is a range of `tv::tuple`
+	template<range Source> requires(!std::same_as<std::remove_cvref_t<Source>, soa_vector>)
+	constexpr explicit soa_vector(Source && source) {
+		for (auto && row : source) {
+			push_back(OPERATORS_FORWARD(row));
+		}
+	}
+
+	constexpr soa_vector(soa_vector && other) noexcept {
+		swap(*this, other);
+	}
+	constexpr soa_vector(soa_vector const & other) {
+		reserve(other.m_size);
+		for (auto const row : other) {
+			push_back(row);
+		}
+	}
+
+	constexpr ~soa_vector() noexcept {
+		clear();
+	}
+
+	constexpr auto operator=(soa_vector && other) & noexcept -> soa_vector & {
+		swap(*this, other);
+		return *this;
+	}
+	constexpr auto operator=(soa_vector const & other) & -> soa_vector & {
+		if (this != std::addressof(other)) {
+			auto temp = other;
+			swap(*this, temp);
+		}
+		return *this;
+	}
+
+	friend constexpr auto swap(soa_vector & lhs, soa_vector & rhs) noexcept -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		(..., swap(lhs.m_columns[indexes], rhs.m_columns[indexes]));
+		std::swap(lhs.m_size, rhs.m_size);
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return const_iterator(tv::tuple<Ts const *...>(m_columns[indexes].data()...), 0);
+	}
+	constexpr auto begin() -> iterator {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return iterator(tv::tuple<Ts *...>(m_columns[indexes].data()...), 0);
+	}
+	constexpr auto end() const -> const_iterator {
+		return begin() + ::bounded::assume_in_range<typename const_iterator::difference_type>(m_size);
+	}
+	constexpr auto end() -> iterator {
+		return begin() + ::bounded::assume_in_range<typename iterator::difference_type>(m_size);
+	}
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+
+	constexpr auto operator[](size_type const index) const -> tv::tuple<Ts const &...> {
+		BOUNDED_ASSERT(index < m_size);
+		return *(begin() + index);
+	}
+	constexpr auto operator[](size_type const index) -> tv::tuple<Ts &...> {
+		BOUNDED_ASSERT(index < m_size);
+		return *(begin() + index);
+	}
+
+	// All of the values of one field
+	template<std::size_t index>
+	constexpr auto column() const {
+		using column_type = tv::tuple_element<index, value_type>;
+		return span<column_type const>(m_columns[bounded::constant<index>].data(), m_size);
+	}
+	template<std::size_t index>
+	constexpr auto column() {
+		using column_type = tv::tuple_element<index, value_type>;
+		return span<column_type>(m_columns[bounded::constant<index>].data(), m_size);
+	}
+
+	constexpr auto capacity() const -> size_type {
+		return m_columns[0_bi].capacity();
+	}
+	// Reallocates every column at once
+	constexpr auto reserve(size_type const new_capacity) -> void {
+		if (new_capacity <= capacity()) {
+			return;
+		}
+		auto new_columns = columns_t(uninitialized_dynamic_array<Ts, size_type>(new_capacity)...);
+		relocate_rows_into(new_columns);
+	}
+
+	constexpr auto push_back(value_type const & row) & -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		append_row(row[indexes]...);
+	}
+	constexpr auto push_back(value_type && row) & -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		append_row(std::move(row)[indexes]...);
+	}
+	// Allows pushing a row of references, like the elements of another
+	// soa_vector
+	template<typename... Us> requires(sizeof...(Us) == sizeof...(Ts) and (... and bounded::constructible_from<Ts, Us>))
+	constexpr auto push_back(tv::tuple<Us...> const & row) & -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		append_row(row[indexes]...);
+	}
+
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		auto const last = static_cast<std::size_t>(m_size) - 1U;
+		(..., bounded::destroy(m_columns[indexes].data()[last]));
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+	}
+	// Keeps the allocation
+	constexpr auto clear() & -> void {
+		while (m_size != 0_bi) {
+			pop_back();
+		}
+	}
+
+	friend constexpr auto operator==(soa_vector const & lhs, soa_vector const & rhs) -> bool {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		return lhs.m_size == rhs.m_size and (... and ::containers::equal(
+			span<Ts const>(lhs.m_columns[indexes].data(), lhs.m_size),
+			span<Ts const>(rhs.m_columns[indexes].data(), rhs.m_size)
+		));
+	}
+
+private:
+	using columns_t = tv::tuple<uninitialized_dynamic_array<Ts, size_type>...>;
+
+	// If the row needs more space, it is constructed in the new columns before
+	// the old rows are relocated, so the fields may refer to elements of this
+	// container.
+	constexpr auto append_row(auto && ... fields) -> void {
+		if (m_size == capacity()) {
+			auto const new_capacity = ::bounded::check_in_range<size_type>(::containers::reallocation_size(capacity(), m_size + 1_bi));
+			auto new_columns = columns_t(uninitialized_dynamic_array<Ts, size_type>(new_capacity)...);
+			construct_fields<0>(new_columns, OPERATORS_FORWARD(fields)...);
+			relocate_rows_into(new_columns);
+		} else {
+			construct_fields<0>(m_columns, OPERATORS_FORWARD(fields)...);
+		}
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+	}
+
+	// Constructs one field at a time. If constructing a field throws, the
+	// fields of the row that were already constructed are destroyed.
+	template<std::size_t index>
+	constexpr auto construct_fields(columns_t & columns, auto && field, auto && ... remaining) const -> void {
+		auto & element = columns[bounded::constant<index>].data()[static_cast<std::size_t>(m_size)];
+		bounded::construct_at(element, [&] -> decltype(auto) { return OPERATORS_FORWARD(field); });
+		if constexpr (sizeof...(remaining) != 0) {
+			try {
+				construct_fields<index + 1>(columns, OPERATORS_FORWARD(remaining)...);
+			} catch (...) {
+				bounded::destroy(element);
+				throw;
+			}
+		}
+	}
+
+	// Moves the existing rows to the front of `new_columns` and takes
+	// ownership of them
+	constexpr auto relocate_rows_into(columns_t & new_columns) -> void {
+		auto const [...indexes] = bounded::index_sequence_struct<sizeof...(Ts)>();
+		(..., ::containers::uninitialized_relocate_no_overlap(span<Ts>(m_columns[indexes].data(), m_size), new_columns[indexes].data()));
+		(..., swap(m_columns[indexes], new_columns[indexes]));
+	}
+
+	columns_t m_columns;
+	size_type m_size = 0_bi;
+};
+
+} // namespace containers
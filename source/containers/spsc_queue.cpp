@@ -0,0 +1,203 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+#include <operators/forward.hpp>
+
+export module containers.spsc_queue;
+
+import containers.begin_end;
+import containers.cache_line_size;
+import containers.dereference;
+import containers.maximum_array_size;
+import containers.range;
+import containers.span;
+import containers.subrange;
+import containers.uninitialized_array;
+import containers.uninitialized_dynamic_array;
+
+import bounded;
+import std_module;
+import tv;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+template<typename Storage>
+constexpr auto storage_capacity(Storage const & storage) -> std::size_t {
+	if constexpr (requires { storage.capacity(); }) {
+		return static_cast<std::size_t>(storage.capacity());
+	} else {
+		return static_cast<std::size_t>(Storage::size());
+	}
+}
+
+// A wait-free queue for exactly one producer thread and one consumer thread.
+// The producer only writes `tail` and the consumer only writes `head`, and
+// each is on its own cache line. Each side also keeps a copy of the other
+// side's index on its own cache line, and reads the other side's cache line
+// only when its copy says the queue is full or empty.
+//
+// The positions only ever increase, and an element's index in the storage is
+// its position modulo the capacity.
+template<typename T, typename Storage>
+struct basic_spsc_queue {
+	basic_spsc_queue() = default;
+	constexpr explicit basic_spsc_queue(Storage storage):
+		m_storage(std::move(storage))
+	{
+	}
+	basic_spsc_queue(basic_spsc_queue const &) = delete;
+	auto operator=(basic_spsc_queue const &) -> basic_spsc_queue & = delete;
+
+	~basic_spsc_queue() {
+		auto const tail = m_producer.tail.load(std::memory_order_acquire);
+		for (auto position = m_consumer.head.load(std::memory_order_relaxed); position != tail; ++position) {
+			bounded::destroy(element(position));
+		}
+	}
+
+	constexpr auto capacity() const -> std::size_t {
+		return ::containers::storage_capacity(m_storage);
+	}
+
+	// Producer functions
+
+	auto try_lazy_push(bounded::construct_function_for<T> auto && constructor) -> bool {
+		auto const tail = m_producer.tail.load(std::memory_order_relaxed);
+		if (free_space(tail, 1) == 0) {
+			return false;
+		}
+		bounded::construct_at(element(tail), OPERATORS_FORWARD(constructor));
+		m_producer.tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+	auto try_push(T const & value) -> bool {
+		return try_lazy_push(bounded::value_to_function(value));
+	}
+	auto try_push(T && value) -> bool {
+		return try_lazy_push(bounded::value_to_function(std::move(value)));
+	}
+
+	// Pushes as much of `source` as fits and publishes it to the consumer all
+	// at once. Returns the part of `source` that did not fit.
+	template<range Source>
+	auto push_range(Source && source) {
+		auto const tail = m_producer.tail.load(std::memory_order_relaxed);
+		auto const space = free_space(tail, capacity());
+		auto it = containers::begin(source);
+		auto const last = containers::end(source);
+		auto position = tail;
+		for (; it != last and position - tail != space; ++it) {
+			bounded::construct_at(element(position), [&] -> decltype(auto) { return dereference<Source>(it); });
+			++position;
+		}
+		m_producer.tail.store(position, std::memory_order_release);
+		return containers::subrange(it, last);
+	}
+
+	// Consumer functions
+
+	auto try_pop() -> tv::optional<T> {
+		auto const head = m_consumer.head.load(std::memory_order_relaxed);
+		if (available(head, 1) == 0) {
+			return tv::none;
+		}
+		auto result = tv::optional<T>(bounded::relocate(element(head)));
+		m_consumer.head.store(head + 1, std::memory_order_release);
+		return result;
+	}
+
+	// The elements that the consumer can read right now, up to the end of the
+	// storage. They stay in the queue until they are removed with
+	// `pop_front_n`, so the consumer can read or move from them in place.
+	auto front_range() -> span<T> {
+		auto const head = m_consumer.head.load(std::memory_order_relaxed);
+		auto const index = index_of(head);
+		auto const count = available(head, capacity() - index);
+		return span<T>(m_storage.data() + index, ::bounded::assume_in_range<array_size_type<T>>(count));
+	}
+	// Removes elements returned by `front_range`
+	auto pop_front_n(std::size_t const count) -> void {
+		auto const head = m_consumer.head.load(std::memory_order_relaxed);
+		BOUNDED_ASSERT(count <= m_consumer.cached_tail - head);
+		for (auto position = head; position != head + count; ++position) {
+			bounded::destroy(element(position));
+		}
+		m_consumer.head.store(head + count, std::memory_order_release);
+	}
+
+private:
+	// The capacity of dynamic storage is always a power of two. The capacity of
+	// static storage is a constant, so this is also a mask if it is a power of
+	// two.
+	constexpr auto index_of(std::size_t const position) const -> std::size_t {
+		if constexpr (requires { m_storage.capacity(); }) {
+			return position & (capacity() - 1U);
+		} else {
+			return position % capacity();
+		}
+	}
+	constexpr auto element(std::size_t const position) -> T & {
+		return m_storage.data()[index_of(position)];
+	}
+
+	// Called by the producer. Returns how many elements can be pushed, up to
+	// `wanted`, rereading the consumer's position only if needed.
+	auto free_space(std::size_t const tail, std::size_t const wanted) -> std::size_t {
+		auto const cached = capacity() - (tail - m_producer.cached_head);
+		if (cached >= wanted) {
+			return wanted;
+		}
+		m_producer.cached_head = m_consumer.head.load(std::memory_order_acquire);
+		return std::min(capacity() - (tail - m_producer.cached_head), wanted);
+	}
+	// Called by the consumer. Returns how many elements can be popped, up to
+	// `wanted`, rereading the producer's position only if needed.
+	auto available(std::size_t const head, std::size_t const wanted) -> std::size_t {
+		auto const cached = m_consumer.cached_tail - head;
+		if (cached >= wanted) {
+			return wanted;
+		}
+		m_consumer.cached_tail = m_producer.tail.load(std::memory_order_acquire);
+		return std::min(m_consumer.cached_tail - head, wanted);
+	}
+
+	struct alignas(cache_line_size) producer_state {
+		std::atomic<std::size_t> tail = 0;
+		std::size_t cached_head = 0;
+	};
+	struct alignas(cache_line_size) consumer_state {
+		std::atomic<std::size_t> head = 0;
+		std::size_t cached_tail = 0;
+	};
+
+	producer_state m_producer;
+	consumer_state m_consumer;
+	alignas(cache_line_size) Storage m_storage;
+};
+
+export template<typename T, array_size_type<T> capacity_> requires(capacity_ > 0_bi)
+using static_spsc_queue = basic_spsc_queue<T, uninitialized_array<T, capacity_>>;
+
+// The capacity is rounded up to a power of two
+export template<typename T>
+struct spsc_queue : basic_spsc_queue<T, uninitialized_dynamic_array<T, array_size_type<T>>> {
+private:
+	using base = basic_spsc_queue<T, uninitialized_dynamic_array<T, array_size_type<T>>>;
+public:
+	explicit spsc_queue(array_size_type<T> const capacity):
+		base(uninitialized_dynamic_array<T, array_size_type<T>>(
+			::bounded::check_in_range<array_size_type<T>>(std::bit_ceil(static_cast<std::size_t>(capacity)))
+		))
+	{
+	}
+};
+
+} // namespace containers
@@ -0,0 +1,283 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+#include <operators/arrow.hpp>
+#include <operators/bracket.hpp>
+#include <operators/forward.hpp>
+
+export module containers.static_ring_buffer;
+
+import containers.algorithms.copy_or_relocate_from;
+import containers.algorithms.uninitialized;
+import containers.array;
+import containers.begin_end;
+import containers.c_array;
+export import containers.common_iterator_functions;
+import containers.compare_container;
+import containers.contiguous_range;
+import containers.data;
+import containers.initializer_range;
+import containers.maximum_array_size;
+import containers.range_value_t;
+import containers.size;
+import containers.span;
+import containers.uninitialized_array;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace containers {
+
+// `position` is less than `2 * capacity`. For a power of two capacity, this is
+// a mask, otherwise it is a compare and a conditional move.
+template<std::size_t capacity>
+constexpr auto ring_buffer_wrap(std::size_t const position) -> std::size_t {
+	if constexpr (std::has_single_bit(capacity)) {
+		return position & (capacity - 1U);
+	} else {
+		return position >= capacity ? position - capacity : position;
+	}
+}
+
+template<typename T, array_size_type<std::remove_const_t<T>> capacity>
+struct static_ring_buffer_iterator {
+	using difference_type = bounded::integer<bounded::normalize<-capacity>, bounded::normalize<capacity>>;
+
+	static_ring_buffer_iterator() = default;
+	// `position` is the index of the first element plus the offset of this
+	// element from it, before wrapping
+	constexpr static_ring_buffer_iterator(T * const data, std::size_t const position):
+		m_data(data),
+		m_position(position)
+	{
+	}
+
+	constexpr operator static_ring_buffer_iterator<T const, capacity>() const requires(!std::is_const_v<T>) {
+		return static_ring_buffer_iterator<T const, capacity>(m_data, m_position);
+	}
+
+	constexpr auto operator*() const -> T & {
+		return m_data[::containers::ring_buffer_wrap<static_cast<std::size_t>(capacity)>(m_position)];
+	}
+	OPERATORS_ARROW_DEFINITIONS
+
+	friend constexpr auto operator+(static_ring_buffer_iterator const it, difference_type const offset) -> static_ring_buffer_iterator {
+		return static_ring_buffer_iterator(
+			it.m_data,
+			static_cast<std::size_t>(static_cast<std::ptrdiff_t>(it.m_position) + static_cast<std::ptrdiff_t>(offset))
+		);
+	}
+	friend constexpr auto operator-(static_ring_buffer_iterator const lhs, static_ring_buffer_iterator const rhs) -> difference_type {
+		return ::bounded::assume_in_range<difference_type>(
+			static_cast<std::ptrdiff_t>(lhs.m_position) - static_cast<std::ptrdiff_t>(rhs.m_position)
+		);
+	}
+	friend constexpr auto operator<=>(static_ring_buffer_iterator const lhs, static_ring_buffer_iterator const rhs) {
+		return lhs.m_position <=> rhs.m_position;
+	}
+	friend constexpr auto operator==(static_ring_buffer_iterator const lhs, static_ring_buffer_iterator const rhs) -> bool {
+		return lhs.m_position == rhs.m_position;
+	}
+
+private:
+	T * m_data = nullptr;
+	std::size_t m_position = 0;
+};
+
+// A first-in, first-out queue that stores up to `capacity_` elements in place
+// and never allocates. The elements can be added or removed at either end.
+// They wrap around the end of the storage, so the elements are in at most two
+// contiguous pieces: `spans()` returns both, and `append` and `pop_front_n`
+// copy and remove elements in bulk, one piece at a time.
+export template<typename T, array_size_type<T> capacity_> requires(capacity_ > 0_bi)
+struct static_ring_buffer : private lexicographical_comparison::base {
+	using size_type = bounded::integer<0, bounded::normalize<capacity_>>;
+	using position_type = bounded::integer<0, bounded::normalize<capacity_ - 1_bi>>;
+	using const_iterator = static_ring_buffer_iterator<T const, capacity_>;
+	using iterator = static_ring_buffer_iterator<T, capacity_>;
+
+	static_ring_buffer() = default;
+
+	constexpr explicit static_ring_buffer(constructor_initializer_range<static_ring_buffer> auto && source) {
+		append_each(OPERATORS_FORWARD(source));
+	}
+
+	template<std::size_t source_size> requires(source_size <= capacity_)
+	constexpr static_ring_buffer(c_array<T, source_size> && source) {
+		append_each(std::move(source));
+	}
+	template<std::same_as<empty_c_array_parameter> Source = empty_c_array_parameter>
+	constexpr static_ring_buffer(Source) {
+	}
+
+	static_ring_buffer(static_ring_buffer &&) requires bounded::trivially_move_constructible<T> = default;
+	constexpr static_ring_buffer(static_ring_buffer && other) noexcept requires(!bounded::trivially_move_constructible<T>) {
+		append_each(std::move(other));
+		other.clear();
+	}
+
+	static_ring_buffer(static_ring_buffer const &) requires bounded::trivially_copy_constructible<T> = default;
+	constexpr static_ring_buffer(static_ring_buffer const & other) requires(!bounded::trivially_copy_constructible<T>) {
+		append_each(other);
+	}
+
+	~static_ring_buffer() requires bounded::trivially_destructible<T> = default;
+	constexpr ~static_ring_buffer() {
+		clear();
+	}
+
+	auto operator=(static_ring_buffer &&) & -> static_ring_buffer & requires bounded::trivially_move_assignable<T> = default;
+	constexpr auto operator=(static_ring_buffer && other) & noexcept -> static_ring_buffer & requires(!bounded::trivially_move_assignable<T>) {
+		if (this != std::addressof(other)) {
+			clear();
+			append_each(std::move(other));
+			other.clear();
+		}
+		return *this;
+	}
+
+	auto operator=(static_ring_buffer const &) & -> static_ring_buffer & requires bounded::trivially_copy_assignable<T> = default;
+	constexpr auto operator=(static_ring_buffer const & other) & -> static_ring_buffer & requires(!bounded::trivially_copy_assignable<T>) {
+		if (this != std::addressof(other)) {
+			clear();
+			append_each(other);
+		}
+		return *this;
+	}
+
+	constexpr auto begin() const -> const_iterator {
+		return const_iterator(m_storage.data(), static_cast<std::size_t>(m_head));
+	}
+	constexpr auto begin() -> iterator {
+		return iterator(m_storage.data(), static_cast<std::size_t>(m_head));
+	}
+	constexpr auto size() const -> size_type {
+		return m_size;
+	}
+	static constexpr auto capacity() {
+		return bounded::constant<capacity_>;
+	}
+	OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS
+
+	// The index in the storage of the first element
+	constexpr auto head() const -> position_type {
+		return m_head;
+	}
+	// The index in the storage where the next element will be added
+	constexpr auto tail() const -> position_type {
+		return wrap(m_head + m_size);
+	}
+
+	// The elements, in order, as two contiguous pieces. The second is empty
+	// unless the elements wrap around the end of the storage.
+	constexpr auto spans() const {
+		return spans_of<T const>(m_storage.data());
+	}
+	constexpr auto spans() {
+		return spans_of<T>(m_storage.data());
+	}
+
+	constexpr auto lazy_push_back(bounded::construct_function_for<T> auto && constructor) & -> T & {
+		if (m_size == capacity()) {
+			throw std::bad_alloc();
+		}
+		auto & element = m_storage.data()[static_cast<std::size_t>(tail())];
+		bounded::construct_at(element, OPERATORS_FORWARD(constructor));
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		return element;
+	}
+	constexpr auto lazy_push_front(bounded::construct_function_for<T> auto && constructor) & -> T & {
+		if (m_size == capacity()) {
+			throw std::bad_alloc();
+		}
+		auto const new_head = wrap(m_head + capacity_ - 1_bi);
+		auto & element = m_storage.data()[static_cast<std::size_t>(new_head)];
+		bounded::construct_at(element, OPERATORS_FORWARD(constructor));
+		m_head = new_head;
+		m_size = ::bounded::assume_in_range<size_type>(m_size + 1_bi);
+		return element;
+	}
+
+	constexpr auto pop_back() & -> void {
+		BOUNDED_ASSERT(m_size != 0_bi);
+		bounded::destroy(m_storage.data()[static_cast<std::size_t>(wrap(m_head + m_size - 1_bi))]);
+		m_size = ::bounded::assume_in_range<size_type>(m_size - 1_bi);
+	}
+	constexpr auto pop_front() & -> void {
+		pop_front_n(1_bi);
+	}
+	// Removes the first `count` elements
+	constexpr auto pop_front_n(size_type const count) & -> void {
+		BOUNDED_ASSERT(count <= m_size);
+		if constexpr (!bounded::trivially_destructible<T>) {
+			for (std::size_t offset = 0; offset != static_cast<std::size_t>(count); ++offset) {
+				bounded::destroy(m_storage.data()[static_cast<std::size_t>(wrap(static_cast<std::size_t>(m_head) + offset))]);
+			}
+		}
+		m_head = wrap(m_head + count);
+		m_size = ::bounded::assume_in_range<size_type>(m_size - count);
+	}
+	constexpr auto clear() & -> void {
+		pop_front_n(m_size);
+		m_head = 0_bi;
+	}
+
+	// Copies all of `source` into the free space in at most two contiguous
+	// copies. There must be enough free space.
+	template<contiguous_range Source> requires std::same_as<range_value_t<Source>, T>
+	constexpr auto append(Source const & source) & -> void {
+		auto const source_size = static_cast<std::size_t>(::containers::size(source));
+		BOUNDED_ASSERT(source_size <= static_cast<std::size_t>(capacity_ - m_size));
+		auto const source_data = ::containers::data(source);
+		auto const first_count = std::min(source_size, static_cast<std::size_t>(capacity_) - static_cast<std::size_t>(tail()));
+		::containers::uninitialized_copy_no_overlap(
+			span<T const>(source_data, ::bounded::assume_in_range<array_size_type<T>>(first_count)),
+			m_storage.data() + static_cast<std::size_t>(tail())
+		);
+		m_size = ::bounded::assume_in_range<size_type>(m_size + bounded::assume_in_range<size_type>(first_count));
+		::containers::uninitialized_copy_no_overlap(
+			span<T const>(source_data + first_count, ::bounded::assume_in_range<array_size_type<T>>(source_size - first_count)),
+			m_storage.data() + static_cast<std::size_t>(tail())
+		);
+		m_size = ::bounded::assume_in_range<size_type>(m_size + bounded::assume_in_range<size_type>(source_size - first_count));
+	}
+
+private:
+	static constexpr auto wrap(auto const position) -> position_type {
+		return ::bounded::assume_in_range<position_type>(
+			::containers::ring_buffer_wrap<static_cast<std::size_t>(capacity_)>(static_cast<std::size_t>(position))
+		);
+	}
+
+	template<typename U>
+	constexpr auto spans_of(U * const data) const {
+		auto const first_count = std::min(
+			static_cast<std::size_t>(m_size),
+			static_cast<std::size_t>(capacity_) - static_cast<std::size_t>(m_head)
+		);
+		return containers::array{
+			span<U>(data + static_cast<std::size_t>(m_head), ::bounded::assume_in_range<array_size_type<T>>(first_count)),
+			span<U>(data, ::bounded::assume_in_range<array_size_type<T>>(static_cast<std::size_t>(m_size) - first_count))
+		};
+	}
+
+	constexpr auto append_each(auto && source) -> void {
+		::containers::copy_or_relocate_from(OPERATORS_FORWARD(source), [&](auto make) {
+			lazy_push_back(make);
+		});
+	}
+
+	[[no_unique_address]] uninitialized_array<T, capacity_> m_storage = {};
+	position_type m_head = 0_bi;
+	size_type m_size = 0_bi;
+};
+
+} // namespace containers
@@ -110,3 +110,16 @@ static_assert(!containers::binary_search(three_two_duplicates_last, 0));
 static_assert(containers::binary_search(three_two_duplicates_last, 1));
 static_assert(containers::binary_search(three_two_duplicates_last, 2));
 static_assert(!containers::binary_search(three_two_duplicates_last, 3));
+
+constexpr auto many = containers::array{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+
+static_assert(containers::gallop_lower_bound(zero, 0) == end(zero));
+static_assert(containers::gallop_lower_bound(one, 1) == begin(one));
+static_assert(containers::gallop_lower_bound(one, 2) == end(one));
+static_assert(containers::gallop_lower_bound(three_two_duplicates_last, 2) == begin(three_two_duplicates_last) + 1_bi);
+static_assert(containers::gallop_lower_bound(many, 0) == begin(many));
+static_assert(containers::gallop_lower_bound(many, 2) == begin(many) + 1_bi);
+static_assert(containers::gallop_lower_bound(many, 6) == begin(many) + 5_bi);
+static_assert(containers::gallop_lower_bound(many, 16) == begin(many) + 15_bi);
+static_assert(containers::gallop_lower_bound(many, 20) == begin(many) + 19_bi);
+static_assert(containers::gallop_lower_bound(many, 21) == end(many));
@@ -126,10 +126,22 @@ struct is_even {
 template<typename Container>
 constexpr auto test_erase_if() {
 	auto v = Container({1, 2, 3, 4, 5, 6, 7});
-	erase_if(v, is_even());
+	auto const erased = erase_if(v, is_even());
+	BOUNDED_ASSERT(erased == 3_bi);
 	BOUNDED_ASSERT(v == Container({1, 3, 5, 7}));
 }
 
+template<typename Container>
+constexpr auto test_erase_if_stateful() {
+	auto v = Container({1, 2, 3, 4, 5, 6, 7});
+	auto const erased = erase_if(v, [calls = 0](auto const &) mutable {
+		++calls;
+		return calls == 2 or calls == 3;
+	});
+	BOUNDED_ASSERT(erased == 2_bi);
+	BOUNDED_ASSERT(v == Container({1, 4, 5, 6, 7}));
+}
+
 template<typename Container>
 constexpr auto test_all() {
 	test_erase_empty<Container>();
@@ -143,6 +155,7 @@ constexpr auto test_all() {
 	test_erase_first_from_three<Container>();
 	test_erase_middle_range<Container>();
 	test_erase_if<Container>();
+	test_erase_if_stateful<Container>();
 	return true;
 }
 
@@ -0,0 +1,91 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.algorithms.merge_k;
+
+import containers.algorithms.compare;
+import containers.algorithms.merge_k;
+
+import containers.array;
+import containers.begin_end;
+import containers.subrange;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+constexpr auto sorted_ranges() {
+	return containers::array({
+		containers::vector<int>({1, 4, 4, 7}),
+		containers::vector<int>(),
+		containers::vector<int>({2, 4, 9}),
+		containers::vector<int>({0, 5}),
+		containers::vector<int>({3}),
+	});
+}
+
+static_assert(containers::equal(
+	containers::merged_view(sorted_ranges()),
+	containers::array({0, 1, 2, 3, 4, 4, 4, 5, 7, 9})
+));
+
+static_assert(containers::equal(
+	containers::merged_view(containers::array<containers::vector<int>, 0_bi>()),
+	containers::array<int, 0_bi>()
+));
+
+static_assert(containers::equal(
+	containers::merged_view(containers::array({containers::vector<int>(), containers::vector<int>()})),
+	containers::array<int, 0_bi>()
+));
+
+static_assert(containers::equal(
+	containers::merged_view(
+		containers::array({containers::array({9, 5, 1}), containers::array({8, 6, 2})}),
+		std::greater()
+	),
+	containers::array({9, 8, 6, 5, 2, 1})
+));
+
+static_assert([] {
+	auto result = containers::array<int, 10_bi>();
+	auto const it = containers::merge_k(sorted_ranges(), containers::begin(result));
+	return
+		it == containers::end(result) and
+		result == containers::array({0, 1, 2, 3, 4, 4, 4, 5, 7, 9});
+}());
+
+static_assert([] {
+	// Equivalent elements keep the order of their ranges
+	using element = std::pair<int, int>;
+	auto const ranges = containers::array({
+		containers::array({element(1, 0), element(2, 0)}),
+		containers::array({element(1, 1), element(2, 1)}),
+		containers::array({element(0, 2), element(1, 2)}),
+	});
+	auto result = containers::array<element, 6_bi>();
+	containers::merge_k(ranges, containers::begin(result), [](element const lhs, element const rhs) {
+		return lhs.first < rhs.first;
+	});
+	return result == containers::array({
+		element(0, 2),
+		element(1, 0),
+		element(1, 1),
+		element(1, 2),
+		element(2, 0),
+		element(2, 1),
+	});
+}());
+
+static_assert([] {
+	auto result = containers::array<int, 10_bi>();
+	auto const it = containers::unique_merge_k(sorted_ranges(), containers::begin(result));
+	return containers::equal(
+		containers::subrange(containers::begin(result), it),
+		containers::array({0, 1, 2, 3, 4, 5, 7, 9})
+	);
+}());
@@ -0,0 +1,69 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.constant_map;
+
+import containers.algorithms.compare;
+
+import containers.array;
+import containers.begin_end;
+import containers.constant_map;
+import containers.lookup;
+import containers.map_value_type;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+using namespace std::string_view_literals;
+
+constexpr auto opcodes = containers::make_constant_map<std::string_view, int>({
+	{"sub", 2},
+	{"add", 1},
+	{"mul", 3},
+	{"div", 4},
+	{"and", 5},
+	{"or", 6},
+	{"xor", 7},
+});
+
+static_assert(opcodes.size() == 7_bi);
+static_assert(*containers::lookup(opcodes, "add"sv) == 1);
+static_assert(*containers::lookup(opcodes, "xor"sv) == 7);
+static_assert(*containers::lookup(opcodes, "sub"sv) == 2);
+static_assert(containers::lookup(opcodes, "mod"sv) == nullptr);
+static_assert(containers::lookup(opcodes, ""sv) == nullptr);
+static_assert(containers::lookup(opcodes, "zzz"sv) == nullptr);
+
+static_assert(containers::equal(
+	opcodes,
+	containers::array({
+		containers::map_value_type{"add"sv, 1},
+		containers::map_value_type{"and"sv, 5},
+		containers::map_value_type{"div"sv, 4},
+		containers::map_value_type{"mul"sv, 3},
+		containers::map_value_type{"or"sv, 6},
+		containers::map_value_type{"sub"sv, 2},
+		containers::map_value_type{"xor"sv, 7},
+	})
+));
+
+constexpr auto single = containers::make_constant_map<int, int>({{5, 50}});
+static_assert(*containers::lookup(single, 5) == 50);
+static_assert(containers::lookup(single, 4) == nullptr);
+static_assert(containers::lookup(single, 6) == nullptr);
+
+static_assert([] {
+	constexpr auto map = containers::make_constant_map<int, int>({
+		{8, 0}, {2, 1}, {6, 2}, {4, 3}, {0, 4}, {10, 5},
+	});
+	for (int key = -1; key != 12; ++key) {
+		auto const found = containers::lookup(map, key);
+		if ((found != nullptr) != (key >= 0 and key <= 10 and key % 2 == 0)) {
+			return false;
+		}
+	}
+	return map.find(7) == containers::end(map);
+}());
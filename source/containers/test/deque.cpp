@@ -0,0 +1,110 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.deque;
+
+import containers.algorithms.compare;
+
+import containers.test.test_sequence_container;
+
+import containers.array;
+import containers.back;
+import containers.begin_end;
+import containers.deque;
+import containers.front;
+import containers.lazy_push_front;
+import containers.pop_back;
+import containers.pop_front;
+import containers.push_back;
+import containers.push_front;
+import containers.resizable_container;
+import containers.size;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+
+using namespace bounded::literal;
+
+static_assert(bounded::convertible_to<containers::deque<int>::iterator, containers::deque<int>::const_iterator>);
+
+static_assert(bounded::default_constructible<containers::deque<int>>);
+static_assert(bounded::default_constructible<containers::deque<bounded_test::integer>>);
+static_assert(containers_test::test_sequence_container<containers::deque<int>>());
+static_assert(containers_test::test_sequence_container<containers::deque<bounded_test::integer>>());
+
+static_assert(containers::resizable_container<containers::deque<int>>);
+static_assert(containers::member_lazy_push_frontable<containers::deque<int>>);
+
+template<typename Integer>
+constexpr auto test_push_both_ends() -> bool {
+	auto d = containers::deque<Integer>();
+	containers::push_back(d, 1);
+	containers::push_front(d, 0);
+	containers::push_back(d, 2);
+	BOUNDED_ASSERT(containers::equal(d, containers::array{0, 1, 2}));
+	auto const & middle = d[1_bi];
+	for (int n = 1; n != 100; ++n) {
+		containers::push_front(d, Integer(-n));
+		containers::push_back(d, Integer(n + 2));
+	}
+	BOUNDED_ASSERT(containers::size(d) == 201_bi);
+	BOUNDED_ASSERT(std::addressof(middle) == std::addressof(d[100_bi]));
+	for (int n = 0; n != 201; ++n) {
+		BOUNDED_ASSERT(d[bounded::assume_in_range<containers::deque<Integer>::size_type>(n)] == n - 99);
+	}
+	BOUNDED_ASSERT(containers::front(d) == -99);
+	BOUNDED_ASSERT(containers::back(d) == 101);
+	containers::pop_front(d);
+	containers::pop_back(d);
+	BOUNDED_ASSERT(containers::front(d) == -98);
+	BOUNDED_ASSERT(containers::back(d) == 100);
+	return true;
+}
+static_assert(test_push_both_ends<int>());
+static_assert(test_push_both_ends<bounded_test::integer>());
+
+constexpr auto test_queue() -> bool {
+	auto d = containers::deque<int>();
+	int next_pushed = 0;
+	int next_popped = 0;
+	for (int round = 0; round != 50; ++round) {
+		for (int n = 0; n != 30; ++n) {
+			containers::push_back(d, next_pushed);
+			++next_pushed;
+		}
+		for (int n = 0; n != 25; ++n) {
+			BOUNDED_ASSERT(containers::front(d) == next_popped);
+			containers::pop_front(d);
+			++next_popped;
+		}
+	}
+	BOUNDED_ASSERT(containers::size(d) == 250_bi);
+	BOUNDED_ASSERT(containers::front(d) == next_popped);
+	BOUNDED_ASSERT(containers::back(d) == next_pushed - 1);
+	return true;
+}
+static_assert(test_queue());
+
+static_assert([] {
+	auto const d = containers::deque<int>({1, 2, 3, 4});
+	auto const last = containers::end(d);
+	BOUNDED_ASSERT(last - containers::begin(d) == 4_bi);
+	BOUNDED_ASSERT(*(containers::begin(d) + 2_bi) == 3);
+	BOUNDED_ASSERT(containers::begin(d) < last);
+	return true;
+}());
+
+static_assert([] {
+	auto d = containers::deque<bounded_test::non_copyable_integer>();
+	containers::lazy_push_front(d, bounded::value_to_function(3));
+	containers::lazy_push_front(d, bounded::value_to_function(4));
+	BOUNDED_ASSERT(d == containers::deque<bounded_test::non_copyable_integer>({4, 3}));
+	return true;
+}());
@@ -0,0 +1,127 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.dynamic_bitset;
+
+import containers.algorithms.compare;
+
+import containers.array;
+import containers.dynamic_bitset;
+import containers.size;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+using index_type = containers::dynamic_bitset::size_type;
+
+constexpr auto test_set_and_reset() -> bool {
+	auto bits = containers::dynamic_bitset(130_bi);
+	BOUNDED_ASSERT(containers::size(bits) == 130_bi);
+	BOUNDED_ASSERT(containers::size(bits.words()) == 3_bi);
+	BOUNDED_ASSERT(bits.none());
+	bits.set(0_bi);
+	bits.set(64_bi);
+	bits.set(129_bi);
+	BOUNDED_ASSERT(bits[0_bi]);
+	BOUNDED_ASSERT(!bits[1_bi]);
+	BOUNDED_ASSERT(bits[64_bi]);
+	BOUNDED_ASSERT(bits[129_bi]);
+	BOUNDED_ASSERT(bits.count() == 3_bi);
+	bits.reset(64_bi);
+	bits.flip(1_bi);
+	bits.set(2_bi, true);
+	BOUNDED_ASSERT(!bits[64_bi]);
+	BOUNDED_ASSERT(bits[1_bi]);
+	BOUNDED_ASSERT(bits.count() == 4_bi);
+	return true;
+}
+static_assert(test_set_and_reset());
+
+constexpr auto test_whole_set_operations_keep_unused_bits_clear() -> bool {
+	auto bits = containers::dynamic_bitset(70_bi, true);
+	BOUNDED_ASSERT(bits.count() == 70_bi);
+	bits.flip_all();
+	BOUNDED_ASSERT(bits.none());
+	bits.set_all();
+	BOUNDED_ASSERT(bits.count() == 70_bi);
+	bits.reset_all();
+	BOUNDED_ASSERT(bits.count() == 0_bi);
+	return true;
+}
+static_assert(test_whole_set_operations_keep_unused_bits_clear());
+
+constexpr auto test_push_and_pop() -> bool {
+	auto bits = containers::dynamic_bitset();
+	for (int n = 0; n != 65; ++n) {
+		bits.push_back(n % 3 == 0);
+	}
+	BOUNDED_ASSERT(containers::size(bits) == 65_bi);
+	BOUNDED_ASSERT(containers::size(bits.words()) == 2_bi);
+	BOUNDED_ASSERT(bits.count() == 22_bi);
+	bits.pop_back();
+	bits.pop_back();
+	BOUNDED_ASSERT(containers::size(bits.words()) == 1_bi);
+	BOUNDED_ASSERT(bits.count() == 21_bi);
+	bits.clear();
+	BOUNDED_ASSERT(containers::size(bits) == 0_bi);
+	return true;
+}
+static_assert(test_push_and_pop());
+
+constexpr auto make_bitset(index_type const size, auto const predicate) {
+	auto bits = containers::dynamic_bitset(size);
+	for (auto index = index_type(0_bi); index != size; ++index) {
+		if (predicate(index)) {
+			bits.set(index);
+		}
+	}
+	return bits;
+}
+
+constexpr auto test_combine() -> bool {
+	auto const multiple_of_2 = make_bitset(200_bi, [](auto const n) { return n % 2_bi == 0_bi; });
+	auto const multiple_of_3 = make_bitset(200_bi, [](auto const n) { return n % 3_bi == 0_bi; });
+	BOUNDED_ASSERT((multiple_of_2 & multiple_of_3) == make_bitset(200_bi, [](auto const n) { return n % 6_bi == 0_bi; }));
+	BOUNDED_ASSERT((multiple_of_2 | multiple_of_3) == make_bitset(200_bi, [](auto const n) { return n % 2_bi == 0_bi or n % 3_bi == 0_bi; }));
+	BOUNDED_ASSERT((multiple_of_2 ^ multiple_of_3) == make_bitset(200_bi, [](auto const n) { return (n % 2_bi == 0_bi) != (n % 3_bi == 0_bi); }));
+	auto difference = multiple_of_2;
+	difference.and_not(multiple_of_3);
+	BOUNDED_ASSERT(difference == make_bitset(200_bi, [](auto const n) { return n % 2_bi == 0_bi and n % 3_bi != 0_bi; }));
+	return true;
+}
+static_assert(test_combine());
+
+constexpr auto test_set_bits() -> bool {
+	auto bits = containers::dynamic_bitset(300_bi);
+	BOUNDED_ASSERT(containers::equal(bits.set_bits(), containers::array<index_type, 0_bi>()));
+	bits.set(3_bi);
+	bits.set(63_bi);
+	bits.set(64_bi);
+	bits.set(299_bi);
+	BOUNDED_ASSERT(containers::equal(bits.set_bits(), containers::array<index_type, 4_bi>{3_bi, 63_bi, 64_bi, 299_bi}));
+	return true;
+}
+static_assert(test_set_bits());
+
+constexpr auto test_rank_and_select() -> bool {
+	auto const bits = make_bitset(2000_bi, [](auto const n) { return n % 3_bi == 0_bi; });
+	auto const index = containers::bitset_rank_select(bits);
+	for (auto n = bounded::integer<0, 2000>(0_bi); n != 2000_bi; ++n) {
+		auto const position = bounded::assume_in_range<index_type>(n);
+		BOUNDED_ASSERT(index.rank(position) == (n + 2_bi) / 3_bi);
+	}
+	BOUNDED_ASSERT(index.rank(2000_bi) == 667_bi);
+	for (auto n = bounded::integer<0, 667>(0_bi); n != 667_bi; ++n) {
+		BOUNDED_ASSERT(index.select(bounded::assume_in_range<index_type>(n)) == n * 3_bi);
+	}
+	return true;
+}
+static_assert(test_rank_and_select());
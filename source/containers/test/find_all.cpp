@@ -0,0 +1,65 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.find_all;
+
+import containers.algorithms.generate;
+import containers.array;
+import containers.begin_end;
+import containers.find_all;
+import containers.flat_map;
+import containers.iterator_t;
+import containers.map_value_type;
+import containers.repeat_n;
+import containers.size;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+constexpr auto make_map() {
+	// Even keys from 0 to 198
+	auto n = 0;
+	return containers::flat_map<int, int>(containers::generate_n(100_bi, [&] {
+		auto const key = n;
+		n += 2;
+		return containers::map_value_type<int, int>(key, key * 10);
+	}));
+}
+
+constexpr auto test_find_all(auto const & queries) -> bool {
+	auto const map = make_map();
+	auto results = containers::vector<containers::iterator_t<decltype(map) const &>>(
+		containers::repeat_n(containers::size(queries), containers::end(map))
+	);
+	auto const last = containers::find_all(map, queries, containers::begin(results));
+	if (last != containers::end(results)) {
+		return false;
+	}
+	auto it = containers::begin(results);
+	for (auto const key : queries) {
+		if (*it != map.find(key)) {
+			return false;
+		}
+		++it;
+	}
+	return true;
+}
+
+static_assert(test_find_all(containers::array<int, 0_bi>()));
+static_assert(test_find_all(containers::array({0})));
+static_assert(test_find_all(containers::array({-1, 0, 1, 2, 3, 50, 51, 198, 199, 1000})));
+static_assert(test_find_all(containers::array({1000, 198, 4, 3, 4, -5, 0, 100, 101, 42, 17, 16, 60, 61, 150, 2, 8, 9, 199, 198, 7})));
+
+static_assert([] {
+	auto const map = containers::flat_map<int, int>();
+	auto results = containers::vector<containers::iterator_t<decltype(map) const &>>(
+		containers::repeat_n(2_bi, containers::begin(map))
+	);
+	containers::find_all(map, containers::array({2, 1}), containers::begin(results));
+	return results[0_bi] == containers::end(map) and results[1_bi] == containers::end(map);
+}());
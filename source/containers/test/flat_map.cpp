@@ -10,13 +10,17 @@ module;
 export module containers.test.flat_map;
 
 import containers.algorithms.compare;
+import containers.algorithms.sort.is_sorted;
 
 import containers.test.test_associative_container;
 import containers.test.test_reserve_and_capacity;
 
+import containers.array;
 import containers.associative_container;
+import containers.begin_end;
 import containers.flat_map;
 import containers.map_tags;
+import containers.map_value_type;
 import containers.maximum_array_size;
 import containers.range_size_t;
 import containers.string_view;
@@ -157,3 +161,221 @@ static_assert(!containers::associative_container<containers::flat_map<int, int>
 static_assert(!containers::associative_container<containers::flat_map<int, int> const &>);
 static_assert(containers::associative_container<containers::flat_map<int, int> &&>);
 static_assert(containers::associative_container<containers::flat_map<int, int>>);
+
+static_assert(containers::associative_range<containers::log_flat_map<int, int>>);
+
+static_assert([] {
+	auto map = containers::log_flat_map<int, int>();
+	// Descending keys, so each insertion would shift every element of a
+	// flat_map
+	for (int n = 100; n != 0; --n) {
+		auto const result = map.lazy_insert(n, [=] { return n * 2; });
+		BOUNDED_ASSERT(result.inserted);
+		BOUNDED_ASSERT(containers::get_mapped(*result.iterator) == n * 2);
+	}
+	BOUNDED_ASSERT(!map.is_merged());
+	BOUNDED_ASSERT(!map.lazy_insert(50, [] { return 0; }).inserted);
+	BOUNDED_ASSERT(!map.lazy_insert(1, [] { return 0; }).inserted);
+	for (int n = 1; n != 101; ++n) {
+		BOUNDED_ASSERT(containers::get_mapped(*map.find(n)) == n * 2);
+	}
+	BOUNDED_ASSERT(map.find(0) == containers::end(map));
+	BOUNDED_ASSERT(map.find(101) == containers::end(map));
+	map.merge();
+	return map.is_merged() and containers::is_sorted(map, map.compare()) and map.size() == 100_bi;
+}());
+
+static_assert([] {
+	auto map = containers::log_flat_map<int, int>({{3, 0}, {1, 0}});
+	map.lazy_insert(2, [] { return 0; });
+	map.insert(containers::log_flat_map<int, int>({{5, 0}, {1, 1}, {4, 0}}));
+	return map.is_merged() and map.size() == 5_bi;
+}());
+
+static_assert([] {
+	auto map = containers::log_flat_map<int, int>({{1, 0}, {3, 0}, {5, 0}, {7, 0}, {9, 0}});
+	map.lazy_insert(4, [] { return 0; });
+	map.erase(map.find(3));
+	map.erase(map.find(4));
+	map.lazy_insert(2, [] { return 0; });
+	map.merge();
+	return containers::equal(map, containers::log_flat_map<int, int>({{1, 0}, {2, 0}, {5, 0}, {7, 0}, {9, 0}}));
+}());
+
+static_assert([] {
+	auto map = containers::flat_map<int, int>({{1, 0}, {3, 0}, {5, 0}, {7, 0}});
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(6, 1),
+		containers::map_value_type<int, int>(2, 1),
+		containers::map_value_type<int, int>(3, 1),
+		containers::map_value_type<int, int>(8, 1),
+		containers::map_value_type<int, int>(2, 1),
+	}));
+	return map == containers::flat_map<int, int>({{1, 0}, {2, 1}, {3, 0}, {5, 0}, {6, 1}, {7, 0}, {8, 1}});
+}());
+
+static_assert([] {
+	auto map = containers::flat_multimap<int, int>({{1, 0}, {3, 0}});
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(3, 1),
+		containers::map_value_type<int, int>(0, 1),
+		containers::map_value_type<int, int>(1, 1),
+	}));
+	return containers::equal(map, containers::array({
+		containers::map_value_type<int, int>(0, 1),
+		containers::map_value_type<int, int>(1, 0),
+		containers::map_value_type<int, int>(1, 1),
+		containers::map_value_type<int, int>(3, 0),
+		containers::map_value_type<int, int>(3, 1),
+	}));
+}());
+
+static_assert([] {
+	auto map = containers::flat_map<int, int>();
+	for (int n = 0; n != 10; ++n) {
+		auto const result = map.lazy_insert(containers::end(map), n, [=] { return n; });
+		BOUNDED_ASSERT(result.inserted);
+	}
+	// Wrong hint
+	BOUNDED_ASSERT(map.lazy_insert(containers::begin(map), 20, [] { return 20; }).inserted);
+	// Already present
+	BOUNDED_ASSERT(!map.lazy_insert(containers::end(map), 20, [] { return 0; }).inserted);
+	BOUNDED_ASSERT(!map.lazy_insert(containers::begin(map), 0, [] { return 0; }).inserted);
+	return map.size() == 11_bi and containers::is_sorted(map, map.compare());
+}());
+
+static_assert([] {
+	auto map = containers::flat_multimap<int, int>({{1, 0}, {3, 0}});
+	map.lazy_insert(containers::begin(map) + 1_bi, 3, [] { return 1; });
+	map.lazy_insert(containers::end(map), 3, [] { return 2; });
+	return containers::equal(map, containers::array({
+		containers::map_value_type<int, int>(1, 0),
+		containers::map_value_type<int, int>(3, 1),
+		containers::map_value_type<int, int>(3, 0),
+		containers::map_value_type<int, int>(3, 2),
+	}));
+}());
+
+static_assert([] {
+	auto map = containers::flat_map<int, int>({{1, 0}, {2, 0}});
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(3, 0),
+		containers::map_value_type<int, int>(4, 0),
+	}));
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(4, 1),
+		containers::map_value_type<int, int>(5, 1),
+	}));
+	return map == containers::flat_map<int, int>({{1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 1}});
+}());
+
+static_assert([] {
+	auto map = containers::flat_map<int, int>({{1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}, {6, 0}});
+	auto const erased = containers::erase_keys(map, containers::array({6, 0, 2, 6, 3}));
+	return erased == 3_bi and map == containers::flat_map<int, int>({{1, 0}, {4, 0}, {5, 0}});
+}());
+
+static_assert([] {
+	auto map = containers::flat_multimap<int, int>({{1, 0}, {2, 0}, {2, 1}, {3, 0}});
+	auto const erased = containers::erase_keys(map, containers::array({2, 3, 4}));
+	return erased == 3_bi and containers::equal(map, containers::array({
+		containers::map_value_type<int, int>(1, 0),
+	}));
+}());
+
+static_assert([] {
+	auto const lhs = containers::flat_map<int, int>({{1, 1}, {3, 3}, {5, 5}});
+	auto const rhs = containers::flat_map<int, int>({{2, 20}, {3, 30}, {6, 60}});
+	return
+		containers::map_union(lhs, rhs) == containers::flat_map<int, int>({{1, 1}, {2, 20}, {3, 3}, {5, 5}, {6, 60}}) and
+		containers::map_union(lhs, rhs, std::plus()) == containers::flat_map<int, int>({{1, 1}, {2, 20}, {3, 33}, {5, 5}, {6, 60}}) and
+		containers::map_intersection(lhs, rhs) == containers::flat_map<int, int>({{3, 3}}) and
+		containers::map_intersection(lhs, rhs, std::plus()) == containers::flat_map<int, int>({{3, 33}}) and
+		containers::map_difference(lhs, rhs) == containers::flat_map<int, int>({{1, 1}, {5, 5}}) and
+		containers::map_difference(rhs, lhs) == containers::flat_map<int, int>({{2, 20}, {6, 60}});
+}());
+
+struct scaled_key {
+	int factor = 1;
+	constexpr auto operator()(int const key) const -> int {
+		return key * factor;
+	}
+};
+
+static_assert([] {
+	// The results are ordered by the key function of the arguments
+	using map_type = containers::flat_map<int, int, scaled_key>;
+	using value_type = containers::map_value_type<int, int>;
+	auto const lhs = map_type({{1, 1}, {3, 3}, {5, 5}}, scaled_key(-1));
+	auto const rhs = map_type({{2, 20}, {3, 30}, {6, 60}}, scaled_key(-1));
+	return
+		containers::equal(containers::map_union(lhs, rhs), containers::array({
+			value_type(6, 60),
+			value_type(5, 5),
+			value_type(3, 3),
+			value_type(2, 20),
+			value_type(1, 1),
+		})) and
+		containers::equal(containers::map_intersection(lhs, rhs), containers::array({value_type(3, 3)})) and
+		containers::equal(containers::map_difference(lhs, rhs), containers::array({value_type(5, 5), value_type(1, 1)}));
+}());
+
+static_assert([] {
+	// Different enough in size to gallop
+	auto large = containers::flat_map<int, int>();
+	for (int key = 0; key != 100; ++key) {
+		large.lazy_insert(containers::end(large), key, [=] { return key; });
+	}
+	auto const small = containers::flat_map<int, int>({{-1, 0}, {7, 0}, {50, 0}, {99, 0}, {150, 0}});
+	auto const expected = containers::flat_map<int, int>({{7, 7}, {50, 50}, {99, 99}});
+	return
+		containers::map_intersection(large, small) == expected and
+		containers::map_intersection(small, large, [](int, int const rhs) { return rhs; }) == expected;
+}());
+
+static_assert([] {
+	using map_type = containers::small_flat_map<int, int, 4>;
+	auto map = map_type();
+	// Linear while small, so insertion order is kept
+	map.lazy_insert(3, [] { return 30; });
+	map.lazy_insert(1, [] { return 10; });
+	map.lazy_insert(2, [] { return 20; });
+	BOUNDED_ASSERT(!map.lazy_insert(1, [] { return 0; }).inserted);
+	BOUNDED_ASSERT(containers::equal(map, containers::array({
+		containers::map_value_type<int, int>(3, 30),
+		containers::map_value_type<int, int>(1, 10),
+		containers::map_value_type<int, int>(2, 20),
+	})));
+	map.lazy_insert(5, [] { return 50; });
+	BOUNDED_ASSERT(map.is_linear());
+	// Sorted once it grows past the linear size
+	auto const [it, inserted] = map.lazy_insert(4, [] { return 40; });
+	BOUNDED_ASSERT(inserted and containers::get_mapped(*it) == 40);
+	BOUNDED_ASSERT(!map.is_linear());
+	BOUNDED_ASSERT(!map.lazy_insert(2, [] { return 0; }).inserted);
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(0, 0),
+		containers::map_value_type<int, int>(3, 0),
+	}));
+	return
+		containers::get_mapped(*map.find(3)) == 30 and
+		map.find(6) == containers::end(map) and
+		containers::equal(map, containers::array({
+			containers::map_value_type<int, int>(0, 0),
+			containers::map_value_type<int, int>(1, 10),
+			containers::map_value_type<int, int>(2, 20),
+			containers::map_value_type<int, int>(3, 30),
+			containers::map_value_type<int, int>(4, 40),
+			containers::map_value_type<int, int>(5, 50),
+		}));
+}());
+
+static_assert([] {
+	auto map = containers::small_flat_map<int, int, 4>();
+	map.lazy_insert(2, [] { return 20; });
+	map.insert(containers::array({
+		containers::map_value_type<int, int>(1, 10),
+		containers::map_value_type<int, int>(2, 0),
+	}));
+	return map.is_linear() and containers::get_mapped(*map.find(2)) == 20 and map.size() == 2_bi;
+}());
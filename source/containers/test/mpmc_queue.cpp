@@ -0,0 +1,83 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <doctest/doctest.h>
+
+import containers.algorithms.compare;
+import containers.array;
+import containers.begin_end;
+import containers.mpmc_queue;
+import containers.push_back;
+import containers.size;
+import containers.vector;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+
+using namespace bounded::literal;
+
+TEST_CASE("mpmc_queue push and pop") {
+	auto queue = containers::mpmc_queue<bounded_test::integer>(3_bi);
+	CHECK(queue.capacity() == 4);
+	CHECK(!queue.try_pop());
+	for (int n = 0; n != 4; ++n) {
+		CHECK(queue.try_push(bounded_test::integer(n)));
+	}
+	CHECK(!queue.try_push(bounded_test::integer(4)));
+	CHECK(*queue.try_pop() == 0);
+	queue.push(bounded_test::integer(4));
+	for (int n = 1; n != 5; ++n) {
+		CHECK(queue.pop() == n);
+	}
+	CHECK(!queue.try_pop());
+}
+
+TEST_CASE("mpmc_queue ranges") {
+	auto queue = containers::mpmc_queue<int>(4_bi);
+	auto const source = containers::array{1, 2, 3, 4, 5, 6};
+	auto const rest = queue.try_push_range(source);
+	CHECK(containers::equal(rest, containers::array{5, 6}));
+	auto output = containers::array<int, 6_bi>();
+	auto const last = queue.try_pop_n(containers::begin(output), 3);
+	CHECK(last - containers::begin(output) == 3_bi);
+	CHECK(output[0_bi] == 1);
+	CHECK(output[2_bi] == 3);
+}
+
+TEST_CASE("mpmc_queue between threads") {
+	constexpr auto threads = 4;
+	constexpr auto per_thread = 20'000;
+	auto queue = containers::mpmc_queue<int>(16_bi);
+	auto sums = containers::array<std::int64_t, bounded::constant<threads>>();
+	auto producers = containers::vector<std::thread>();
+	auto consumers = containers::vector<std::thread>();
+	for (int thread = 0; thread != threads; ++thread) {
+		containers::push_back(producers, std::thread([&, thread] {
+			for (int n = 0; n != per_thread; ++n) {
+				queue.push(thread * per_thread + n);
+			}
+		}));
+		containers::push_back(consumers, std::thread([&, thread] {
+			auto & sum = sums[bounded::assume_in_range<bounded::integer<0, threads - 1>>(thread)];
+			for (int n = 0; n != per_thread; ++n) {
+				sum += queue.pop();
+			}
+		}));
+	}
+	for (auto & thread : producers) {
+		thread.join();
+	}
+	for (auto & thread : consumers) {
+		thread.join();
+	}
+	auto total = std::int64_t(0);
+	for (auto const sum : sums) {
+		total += sum;
+	}
+	constexpr auto count = std::int64_t(threads) * per_thread;
+	CHECK(total == count * (count - 1) / 2);
+	CHECK(!queue.try_pop());
+}
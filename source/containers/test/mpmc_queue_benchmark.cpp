@@ -0,0 +1,81 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+
+import bounded;
+import containers;
+import std_module;
+
+namespace {
+
+using namespace bounded::literal;
+
+// The baseline: one lock around a deque
+template<typename T>
+struct locked_queue {
+	explicit locked_queue(auto const capacity):
+		m_capacity(static_cast<std::size_t>(capacity))
+	{
+	}
+	auto push(T value) -> void {
+		auto lock = std::unique_lock(m_mutex);
+		m_not_full.wait(lock, [&] { return static_cast<std::size_t>(containers::size(m_elements)) != m_capacity; });
+		containers::push_back(m_elements, std::move(value));
+		lock.unlock();
+		m_not_empty.notify_one();
+	}
+	auto pop() -> T {
+		auto lock = std::unique_lock(m_mutex);
+		m_not_empty.wait(lock, [&] { return !containers::is_empty(m_elements); });
+		auto result = std::move(containers::front(m_elements));
+		containers::pop_front(m_elements);
+		lock.unlock();
+		m_not_full.notify_one();
+		return result;
+	}
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_not_empty;
+	std::condition_variable m_not_full;
+	containers::deque<T> m_elements;
+	std::size_t m_capacity;
+};
+
+constexpr auto capacity = 1024_bi;
+constexpr auto messages_per_iteration = 1 << 12;
+
+// Half of the benchmark threads push and the other half pop the same number of
+// messages, so every iteration ends with the queue empty. The queue is shared
+// by all of the threads. A single thread pushes and then pops each message,
+// which gives the cost without contention.
+template<typename Queue>
+auto benchmark_scaling(benchmark::State & state) -> void {
+	static auto queue = std::unique_ptr<Queue>();
+	if (state.thread_index() == 0) {
+		queue = std::make_unique<Queue>(capacity);
+	}
+	auto const producer = state.thread_index() % 2 == 0;
+	auto total = std::uint64_t(0);
+	for (auto _ : state) {
+		for (std::uint64_t n = 0; n != messages_per_iteration; ++n) {
+			if (state.threads() == 1) {
+				queue->push(n);
+				total += queue->pop();
+			} else if (producer) {
+				queue->push(n);
+			} else {
+				total += queue->pop();
+			}
+		}
+	}
+	benchmark::DoNotOptimize(total);
+	state.SetItemsProcessed(state.iterations() * messages_per_iteration);
+}
+
+BENCHMARK(benchmark_scaling<containers::mpmc_queue<std::uint64_t>>)->Threads(1)->DenseThreadRange(2, 16, 2)->UseRealTime();
+BENCHMARK(benchmark_scaling<locked_queue<std::uint64_t>>)->Threads(1)->DenseThreadRange(2, 16, 2)->UseRealTime();
+
+} // namespace
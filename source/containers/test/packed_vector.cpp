@@ -0,0 +1,156 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.packed_vector;
+
+import containers.array;
+import containers.begin_end;
+import containers.packed_vector;
+import containers.size;
+
+import bounded;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+static_assert(containers::packed_vector<bounded::integer<0, 1>>::element_bits == 1);
+static_assert(containers::packed_vector<bounded::integer<0, 1000>>::element_bits == 10);
+static_assert(containers::packed_vector<bounded::integer<1000, 1255>>::element_bits == 8);
+static_assert(containers::packed_vector<bounded::integer<-3, 4>>::element_bits == 3);
+static_assert(containers::packed_vector<bounded::integer<5, 5>>::element_bits == 0);
+static_assert(containers::packed_vector<bounded::integer<0, bounded::normalize<numeric_traits::max_value<std::uint64_t>>>>::element_bits == 64);
+
+static_assert(bounded::convertible_to<
+	containers::packed_vector<bounded::integer<0, 7>>::iterator,
+	containers::packed_vector<bounded::integer<0, 7>>::const_iterator
+>);
+
+template<typename T>
+constexpr auto value_at(int const index) -> T {
+	constexpr auto range = static_cast<std::int64_t>(numeric_traits::max_value<T> - numeric_traits::min_value<T>) + 1;
+	return bounded::assume_in_range<T>(static_cast<std::int64_t>(numeric_traits::min_value<T>) + (index * 7) % range);
+}
+
+template<typename T>
+constexpr auto test_push_back_and_read(int const count) -> bool {
+	auto v = containers::packed_vector<T>();
+	for (int n = 0; n != count; ++n) {
+		v.push_back(value_at<T>(n));
+	}
+	BOUNDED_ASSERT(containers::size(v) == bounded::assume_in_range<typename containers::packed_vector<T>::size_type>(count));
+	auto const & const_v = v;
+	auto it = containers::begin(const_v);
+	for (int n = 0; n != count; ++n) {
+		BOUNDED_ASSERT(*it == value_at<T>(n));
+		++it;
+	}
+	BOUNDED_ASSERT(it == containers::end(const_v));
+	return true;
+}
+static_assert(test_push_back_and_read<bounded::integer<0, 1>>(200));
+static_assert(test_push_back_and_read<bounded::integer<0, 1000>>(200));
+static_assert(test_push_back_and_read<bounded::integer<-3, 4>>(200));
+static_assert(test_push_back_and_read<bounded::integer<5, 5>>(10));
+static_assert(test_push_back_and_read<bounded::integer<0, 1'000'000'000'000>>(50));
+
+constexpr auto test_assign_through_reference() -> bool {
+	using value_type = bounded::integer<0, 1000>;
+	auto v = containers::packed_vector<value_type>();
+	for (int n = 0; n != 20; ++n) {
+		v.push_back(0_bi);
+	}
+	// Element 6 is split between the first two words
+	v[6_bi] = 1000_bi;
+	v[7_bi] = 999_bi;
+	BOUNDED_ASSERT(v[5_bi] == 0_bi);
+	BOUNDED_ASSERT(v[6_bi] == 1000_bi);
+	BOUNDED_ASSERT(v[7_bi] == 999_bi);
+	BOUNDED_ASSERT(v[8_bi] == 0_bi);
+	*containers::begin(v) = 3_bi;
+	BOUNDED_ASSERT(v[0_bi] == 3_bi);
+	v[6_bi] = v[0_bi];
+	BOUNDED_ASSERT(v[6_bi] == 3_bi);
+	BOUNDED_ASSERT(v[7_bi] == 999_bi);
+	return true;
+}
+static_assert(test_assign_through_reference());
+
+constexpr auto test_pop_back() -> bool {
+	auto v = containers::packed_vector<bounded::integer<0, 1000>>();
+	for (int n = 0; n != 13; ++n) {
+		v.push_back(bounded::assume_in_range<bounded::integer<0, 1000>>(n));
+	}
+	BOUNDED_ASSERT(v.word_count() == 3);
+	v.pop_back();
+	v.pop_back();
+	BOUNDED_ASSERT(containers::size(v) == 11_bi);
+	BOUNDED_ASSERT(v.word_count() == 2);
+	v.push_back(500_bi);
+	BOUNDED_ASSERT(v[10_bi] == 10_bi);
+	BOUNDED_ASSERT(v[11_bi] == 500_bi);
+	v.clear();
+	BOUNDED_ASSERT(containers::size(v) == 0_bi);
+	return true;
+}
+static_assert(test_pop_back());
+
+template<typename T>
+constexpr auto test_bulk(int const initial) -> bool {
+	auto v = containers::packed_vector<T>();
+	for (int n = 0; n != initial; ++n) {
+		v.push_back(value_at<T>(n));
+	}
+	auto source = containers::array<T, 100_bi>();
+	for (int n = 0; n != 100; ++n) {
+		source[bounded::assume_in_range<containers::array_size_type<T>>(n)] = value_at<T>(initial + n);
+	}
+	v.append(source);
+
+	auto output = containers::array<T, 200_bi>();
+	auto const last = v.unpack(containers::begin(output));
+	BOUNDED_ASSERT(last - containers::begin(output) == initial + 100);
+	for (int n = 0; n != initial + 100; ++n) {
+		auto const index = bounded::assume_in_range<containers::array_size_type<T>>(n);
+		BOUNDED_ASSERT(output[index] == value_at<T>(n));
+		BOUNDED_ASSERT(std::as_const(v)[index] == value_at<T>(n));
+	}
+	return true;
+}
+static_assert(test_bulk<bounded::integer<0, 1000>>(0));
+static_assert(test_bulk<bounded::integer<0, 1000>>(7));
+static_assert(test_bulk<bounded::integer<-3, 4>>(5));
+static_assert(test_bulk<bounded::integer<0, 255>>(3));
+static_assert(test_bulk<bounded::integer<5, 5>>(3));
+
+constexpr auto test_append_after_pop_back() -> bool {
+	using value_type = bounded::integer<0, 1000>;
+	auto v = containers::packed_vector<value_type>();
+	v.push_back(5_bi);
+	v.push_back(7_bi);
+	v.pop_back();
+	v.append(containers::array<value_type, 1_bi>{1_bi});
+	BOUNDED_ASSERT(containers::size(v) == 2_bi);
+	BOUNDED_ASSERT(v[0_bi] == 5_bi);
+	BOUNDED_ASSERT(v[1_bi] == 1_bi);
+	return true;
+}
+static_assert(test_append_after_pop_back());
+
+constexpr auto test_range_constructor_and_comparison() -> bool {
+	using value_type = bounded::integer<0, 9>;
+	auto const a = containers::packed_vector<value_type>(containers::array<value_type, 3_bi>{1_bi, 2_bi, 3_bi});
+	auto const b = containers::packed_vector<value_type>(containers::array<value_type, 3_bi>{1_bi, 2_bi, 3_bi});
+	auto const c = containers::packed_vector<value_type>(containers::array<value_type, 3_bi>{1_bi, 2_bi, 4_bi});
+	BOUNDED_ASSERT(a == b);
+	BOUNDED_ASSERT(a != c);
+	BOUNDED_ASSERT(a < c);
+	return true;
+}
+static_assert(test_range_constructor_and_comparison());
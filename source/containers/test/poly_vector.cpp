@@ -0,0 +1,103 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.poly_vector;
+
+import containers.algorithms.compare;
+
+import containers.array;
+import containers.poly_vector;
+import containers.size;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+import tv;
+
+using namespace bounded::literal;
+
+struct circle {
+	int radius;
+	friend auto operator==(circle, circle) -> bool = default;
+};
+struct square {
+	int side;
+	friend auto operator==(square, square) -> bool = default;
+};
+
+constexpr auto area(circle const value) -> int {
+	return 3 * value.radius * value.radius;
+}
+constexpr auto area(square const value) -> int {
+	return value.side * value.side;
+}
+
+template<typename Container>
+constexpr auto fill() -> Container {
+	auto shapes = Container();
+	shapes.push_back(circle(1));
+	shapes.push_back(square(2));
+	shapes.push_back(circle(3));
+	shapes.push_back(tv::variant<circle, square>(square(4)));
+	return shapes;
+}
+
+constexpr auto test_elements_are_grouped_by_type() -> bool {
+	auto const shapes = fill<containers::poly_vector<circle, square>>();
+	BOUNDED_ASSERT(containers::size(shapes) == 4_bi);
+	BOUNDED_ASSERT(containers::equal(shapes.elements<circle>(), containers::array{circle(1), circle(3)}));
+	BOUNDED_ASSERT(containers::equal(shapes.elements<square>(), containers::array{square(2), square(4)}));
+	return true;
+}
+static_assert(test_elements_are_grouped_by_type());
+
+constexpr auto test_for_each() -> bool {
+	auto shapes = fill<containers::poly_vector<circle, square>>();
+	auto total = 0;
+	shapes.for_each([&](auto const shape) { total += area(shape); });
+	BOUNDED_ASSERT(total == 3 + 27 + 4 + 16);
+	shapes.for_each(tv::overload(
+		[](circle & shape) { shape.radius *= 2; },
+		[](square &) {}
+	));
+	BOUNDED_ASSERT(containers::equal(shapes.elements<circle>(), containers::array{circle(2), circle(6)}));
+	return true;
+}
+static_assert(test_for_each());
+
+constexpr auto test_for_each_in_order() -> bool {
+	auto const shapes = fill<containers::ordered_poly_vector<circle, square>>();
+	// Each area is two decimal digits, in the order the shapes were added
+	auto areas = 0;
+	shapes.for_each_in_order([&](auto const shape) {
+		areas = areas * 100 + area(shape);
+	});
+	BOUNDED_ASSERT(areas == 3'04'27'16);
+	return true;
+}
+static_assert(test_for_each_in_order());
+
+constexpr auto test_clear_and_compare() -> bool {
+	auto shapes = fill<containers::ordered_poly_vector<circle, square>>();
+	BOUNDED_ASSERT(shapes == fill<containers::ordered_poly_vector<circle, square>>());
+	shapes.clear();
+	BOUNDED_ASSERT(containers::size(shapes) == 0_bi);
+	BOUNDED_ASSERT(shapes != fill<containers::ordered_poly_vector<circle, square>>());
+	return true;
+}
+static_assert(test_clear_and_compare());
+
+constexpr auto test_non_trivial_type() -> bool {
+	auto values = containers::poly_vector<bounded_test::integer, bool>();
+	values.push_back(bounded_test::integer(5));
+	values.push_back(true);
+	BOUNDED_ASSERT(values.elements<bounded_test::integer>()[0_bi] == 5);
+	return true;
+}
+static_assert(test_non_trivial_type());
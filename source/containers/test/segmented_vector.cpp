@@ -0,0 +1,109 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.segmented_vector;
+
+import containers.algorithms.compare;
+
+import containers.test.test_sequence_container;
+
+import containers.array;
+import containers.back;
+import containers.begin_end;
+import containers.front;
+import containers.pop_back;
+import containers.push_back;
+import containers.segmented_vector;
+import containers.size;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+
+using namespace bounded::literal;
+
+static_assert(bounded::convertible_to<containers::segmented_vector<int>::iterator, containers::segmented_vector<int>::const_iterator>);
+
+static_assert(bounded::default_constructible<containers::segmented_vector<int>>);
+static_assert(bounded::default_constructible<containers::segmented_vector<bounded_test::integer>>);
+static_assert(containers_test::test_sequence_container<containers::segmented_vector<int>>());
+static_assert(containers_test::test_sequence_container<containers::segmented_vector<bounded_test::integer>>());
+
+template<typename Integer>
+constexpr auto test_elements_do_not_move() -> bool {
+	auto v = containers::segmented_vector<Integer>();
+	containers::push_back(v, 0);
+	auto const first = std::addressof(containers::front(v));
+	auto const iterator = containers::begin(v);
+	for (int n = 1; n != 200; ++n) {
+		auto const & element = v.lazy_push_back([=] { return Integer(n); });
+		BOUNDED_ASSERT(std::addressof(element) == std::addressof(containers::back(v)));
+	}
+	BOUNDED_ASSERT(containers::size(v) == 200_bi);
+	BOUNDED_ASSERT(std::addressof(containers::front(v)) == first);
+	BOUNDED_ASSERT(std::addressof(*iterator) == first);
+	for (int n = 0; n != 200; ++n) {
+		BOUNDED_ASSERT(v[bounded::assume_in_range<containers::segmented_vector<Integer>::size_type>(n)] == n);
+	}
+	return true;
+}
+static_assert(test_elements_do_not_move<int>());
+static_assert(test_elements_do_not_move<bounded_test::integer>());
+
+constexpr auto test_segments() -> bool {
+	auto v = containers::segmented_vector<int>();
+	BOUNDED_ASSERT(v.segment_count() == 0);
+	for (int n = 0; n != 50; ++n) {
+		containers::push_back(v, n);
+	}
+	// 16 + 32 + 2
+	BOUNDED_ASSERT(v.segment_count() == 3);
+	BOUNDED_ASSERT(containers::size(v.segment(0)) == 16_bi);
+	BOUNDED_ASSERT(containers::size(v.segment(1)) == 32_bi);
+	BOUNDED_ASSERT(containers::size(v.segment(2)) == 2_bi);
+	BOUNDED_ASSERT(containers::front(v.segment(1)) == 16);
+	BOUNDED_ASSERT(containers::equal(v.segment(2), containers::array{48, 49}));
+	int expected = 0;
+	for (std::size_t index = 0; index != v.segment_count(); ++index) {
+		for (auto const value : v.segment(index)) {
+			BOUNDED_ASSERT(value == expected);
+			++expected;
+		}
+	}
+	BOUNDED_ASSERT(expected == 50);
+	return true;
+}
+static_assert(test_segments());
+
+constexpr auto test_reserve_and_pop_back() -> bool {
+	auto v = containers::segmented_vector<int>();
+	BOUNDED_ASSERT(v.capacity() == 0_bi);
+	v.reserve(20_bi);
+	BOUNDED_ASSERT(v.capacity() == 48_bi);
+	for (int n = 0; n != 20; ++n) {
+		containers::push_back(v, n);
+	}
+	BOUNDED_ASSERT(v.capacity() == 48_bi);
+	containers::pop_back(v);
+	BOUNDED_ASSERT(containers::size(v) == 19_bi);
+	BOUNDED_ASSERT(containers::back(v) == 18);
+	v.clear();
+	BOUNDED_ASSERT(containers::size(v) == 0_bi);
+	BOUNDED_ASSERT(v.capacity() == 48_bi);
+	return true;
+}
+static_assert(test_reserve_and_pop_back());
+
+static_assert([] {
+	auto const v = containers::segmented_vector<int>({1, 2, 3});
+	auto const last = containers::end(v);
+	BOUNDED_ASSERT(last - containers::begin(v) == 3_bi);
+	BOUNDED_ASSERT(containers::begin(v) < last);
+	return true;
+}());
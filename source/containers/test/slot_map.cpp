@@ -0,0 +1,123 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.slot_map;
+
+import containers.begin_end;
+import containers.maximum_array_size;
+import containers.push_back;
+import containers.size;
+import containers.slot_map;
+import containers.vector;
+
+import bounded;
+import bounded.test_int;
+import numeric_traits;
+import std_module;
+
+using namespace bounded::literal;
+
+static_assert(sizeof(containers::slot_map<int>::key_type) == sizeof(std::uint64_t));
+static_assert(numeric_traits::max_value<containers::slot_map<int>::key_type::index_type> == numeric_traits::max_value<std::uint32_t> - 1_bi);
+static_assert(numeric_traits::max_value<containers::slot_map<int>::key_type::generation_type> == numeric_traits::max_value<std::uint32_t>);
+static_assert(numeric_traits::max_value<containers::slot_map<int, 1024_bi>::key_type::generation_type> == (1_bi << 54_bi) - 1_bi);
+
+constexpr auto key_round_trip() -> bool {
+	using key_type = containers::slot_map_key<1000_bi>;
+	auto const key = key_type(999_bi, 123'456_bi);
+	BOUNDED_ASSERT(key.index() == 999_bi);
+	BOUNDED_ASSERT(key.generation() == 123'456_bi);
+	return true;
+}
+static_assert(key_round_trip());
+
+template<typename T>
+constexpr auto test_insert_and_lookup() -> bool {
+	auto map = containers::slot_map<T>();
+	auto const a = map.insert(T(1));
+	auto const b = map.insert(T(2));
+	auto const c = map.insert(T(3));
+	BOUNDED_ASSERT(containers::size(map) == 3_bi);
+	BOUNDED_ASSERT(*map.lookup(a) == 1);
+	BOUNDED_ASSERT(*map.lookup(b) == 2);
+	BOUNDED_ASSERT(*map.lookup(c) == 3);
+	*map.lookup(b) = T(20);
+	BOUNDED_ASSERT(*std::as_const(map).lookup(b) == 20);
+	return true;
+}
+static_assert(test_insert_and_lookup<int>());
+static_assert(test_insert_and_lookup<bounded_test::integer>());
+
+template<typename T>
+constexpr auto test_erase() -> bool {
+	auto map = containers::slot_map<T>();
+	auto const a = map.insert(T(1));
+	auto const b = map.insert(T(2));
+	auto const c = map.insert(T(3));
+	BOUNDED_ASSERT(map.erase(a));
+	BOUNDED_ASSERT(!map.erase(a));
+	BOUNDED_ASSERT(!map.contains(a));
+	BOUNDED_ASSERT(map.lookup(a) == nullptr);
+	// The last value moves into the gap
+	BOUNDED_ASSERT(containers::size(map) == 2_bi);
+	BOUNDED_ASSERT(*containers::begin(map) == 3);
+	BOUNDED_ASSERT(*map.lookup(b) == 2);
+	BOUNDED_ASSERT(*map.lookup(c) == 3);
+	BOUNDED_ASSERT(map.key_at(0_bi) == c);
+	BOUNDED_ASSERT(map.key_at(1_bi) == b);
+
+	// The slot is reused with a new generation
+	auto const d = map.insert(T(4));
+	BOUNDED_ASSERT(d.index() == a.index());
+	BOUNDED_ASSERT(d.generation() != a.generation());
+	BOUNDED_ASSERT(map.lookup(a) == nullptr);
+	BOUNDED_ASSERT(*map.lookup(d) == 4);
+	return true;
+}
+static_assert(test_erase<int>());
+static_assert(test_erase<bounded_test::integer>());
+
+constexpr auto test_clear() -> bool {
+	auto map = containers::slot_map<int>();
+	auto const a = map.insert(1);
+	auto const b = map.insert(2);
+	map.clear();
+	BOUNDED_ASSERT(containers::size(map) == 0_bi);
+	BOUNDED_ASSERT(!map.contains(a));
+	BOUNDED_ASSERT(!map.contains(b));
+	auto const c = map.insert(3);
+	BOUNDED_ASSERT(!map.contains(a));
+	BOUNDED_ASSERT(!map.contains(b));
+	BOUNDED_ASSERT(*map.lookup(c) == 3);
+	return true;
+}
+static_assert(test_clear());
+
+constexpr auto test_many() -> bool {
+	auto map = containers::slot_map<int>();
+	auto keys = containers::vector<containers::slot_map<int>::key_type>();
+	for (int n = 0; n != 100; ++n) {
+		containers::push_back(keys, map.insert(n));
+	}
+	for (int n = 0; n != 100; n += 2) {
+		BOUNDED_ASSERT(map.erase(keys[bounded::assume_in_range<containers::array_size_type<containers::slot_map<int>::key_type>>(n)]));
+	}
+	BOUNDED_ASSERT(containers::size(map) == 50_bi);
+	for (int n = 0; n != 100; ++n) {
+		auto const value = map.lookup(keys[bounded::assume_in_range<containers::array_size_type<containers::slot_map<int>::key_type>>(n)]);
+		BOUNDED_ASSERT(n % 2 == 0 ? value == nullptr : *value == n);
+	}
+	auto sum = 0;
+	for (auto it = containers::begin(map); it != containers::end(map); ++it) {
+		sum += *it;
+	}
+	BOUNDED_ASSERT(sum == 2500);
+	return true;
+}
+static_assert(test_many());
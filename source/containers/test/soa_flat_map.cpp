@@ -0,0 +1,110 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.soa_flat_map;
+
+import containers.algorithms.compare;
+
+import containers.array;
+import containers.begin_end;
+import containers.lookup;
+import containers.map_tags;
+import containers.map_value_type;
+import containers.push_back;
+import containers.soa_flat_map;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using map_type = containers::soa_flat_map<int, int>;
+
+constexpr auto make_map() {
+	return map_type(containers::array({
+		containers::map_value_type{5, 50},
+		containers::map_value_type{1, 10},
+		containers::map_value_type{3, 30},
+	}));
+}
+
+static_assert(make_map().keys() == containers::vector<int>({1, 3, 5}));
+static_assert(make_map().values() == containers::vector<int>({10, 30, 50}));
+
+static_assert(map_type(containers::array({
+	containers::map_value_type{2, 0},
+	containers::map_value_type{1, 0},
+	containers::map_value_type{2, 0},
+	containers::map_value_type{1, 0},
+})).keys() == containers::vector<int>({1, 2}));
+
+static_assert([] {
+	auto const map = make_map();
+	return
+		*containers::lookup(map, 3) == 30 and
+		containers::lookup(map, 4) == nullptr and
+		map.find(6) == containers::end(map);
+}());
+
+static_assert([] {
+	auto map = make_map();
+	auto const [it, inserted] = map.lazy_insert(4, [] { return 40; });
+	auto const [existing, inserted_existing] = map.lazy_insert(3, [] { return 0; });
+	return
+		inserted and
+		containers::get_key(*it) == 4 and
+		!inserted_existing and
+		containers::get_mapped(*existing) == 30 and
+		map.keys() == containers::vector<int>({1, 3, 4, 5}) and
+		map.values() == containers::vector<int>({10, 30, 40, 50});
+}());
+
+static_assert([] {
+	auto map = map_type(containers::assume_sorted_unique, containers::vector<int>({2, 4, 6}), containers::vector<int>({20, 40, 60}));
+	map.insert(containers::array({
+		containers::map_value_type{7, 70},
+		containers::map_value_type{4, 0},
+		containers::map_value_type{1, 10},
+		containers::map_value_type{5, 50},
+		containers::map_value_type{5, 51},
+	}));
+	return
+		map.keys() == containers::vector<int>({1, 2, 4, 5, 6, 7}) and
+		containers::get_mapped(*map.find(1)) == 10 and
+		containers::get_mapped(*map.find(2)) == 20 and
+		containers::get_mapped(*map.find(4)) == 40 and
+		containers::get_mapped(*map.find(5)) == 50 and
+		containers::get_mapped(*map.find(6)) == 60 and
+		containers::get_mapped(*map.find(7)) == 70;
+}());
+
+static_assert([] {
+	// The first of each group of equivalent keys in the batch is kept, unless
+	// the key is already in the map
+	auto map = map_type(containers::assume_sorted_unique, containers::vector<int>({3, 12}), containers::vector<int>({-3, -12}));
+	auto batch = containers::vector<containers::map_value_type<int, int>>();
+	for (int n = 0; n != 300; ++n) {
+		containers::push_back(batch, containers::map_value_type{(n * 7) % 10, n});
+	}
+	map.insert(batch);
+	if (map.keys() != containers::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12})) {
+		return false;
+	}
+	for (int key = 0; key != 10; ++key) {
+		auto const expected = key == 3 ? -3 : (key * 3) % 10;
+		if (containers::get_mapped(*map.find(key)) != expected) {
+			return false;
+		}
+	}
+	return containers::get_mapped(*map.find(12)) == -12;
+}());
+
+static_assert([] {
+	auto map = map_type(containers::assume_sorted_unique, containers::vector<int>({2, 4, 6}), containers::vector<int>({20, 40, 60}));
+	containers::get_mapped(*map.find(4)) = 41;
+	auto const it = map.erase(map.find(2));
+	return
+		containers::get_key(*it) == 4 and
+		map == map_type(containers::assume_sorted_unique, containers::vector<int>({4, 6}), containers::vector<int>({41, 60}));
+}());
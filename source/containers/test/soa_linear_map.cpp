@@ -0,0 +1,70 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.soa_linear_map;
+
+import containers.array;
+import containers.begin_end;
+import containers.lookup;
+import containers.map_value_type;
+import containers.soa_linear_map;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+static_assert([] {
+	auto map = containers::soa_linear_map<int, int>(containers::array({
+		containers::map_value_type{3, 30},
+		containers::map_value_type{1, 10},
+		containers::map_value_type{3, 31},
+		containers::map_value_type{2, 20},
+	}));
+	return
+		map.keys() == containers::vector<int>({3, 1, 2}) and
+		map.values() == containers::vector<int>({30, 10, 20}) and
+		*containers::lookup(map, 2) == 20 and
+		containers::lookup(map, 4) == nullptr;
+}());
+
+// Enough keys to use several full blocks and a partial block
+static_assert([] {
+	auto map = containers::soa_linear_map<std::uint32_t, int>();
+	for (int key = 0; key != 75; ++key) {
+		auto const [it, inserted] = map.lazy_insert(static_cast<std::uint32_t>(key * 3), [=] { return key; });
+		if (!inserted or containers::get_mapped(*it) != key) {
+			return false;
+		}
+	}
+	for (int key = 0; key != 225; ++key) {
+		auto const found = containers::lookup(map, static_cast<std::uint32_t>(key));
+		if (key % 3 == 0 ? found == nullptr or *found != key / 3 : found != nullptr) {
+			return false;
+		}
+	}
+	return !map.lazy_insert(std::uint32_t(222), [] { return 0; }).inserted;
+}());
+
+static_assert([] {
+	auto map = containers::static_soa_linear_map<bounded::integer<0, 100>, int, 10>();
+	map.lazy_insert(bounded::integer<0, 100>(5_bi), [] { return 1; });
+	map.lazy_insert(bounded::integer<0, 100>(7_bi), [] { return 2; });
+	map.lazy_insert(bounded::integer<0, 100>(9_bi), [] { return 3; });
+	auto const it = map.erase(map.find(5_bi));
+	return
+		containers::get_key(*it) == 7_bi and
+		map.find(5_bi) == containers::end(map) and
+		*containers::lookup(map, bounded::integer<0, 100>(9_bi)) == 3;
+}());
+
+// Keys that are not integers are compared one at a time
+static_assert([] {
+	auto map = containers::soa_linear_map<std::string_view, int>();
+	map.lazy_insert(std::string_view("a"), [] { return 1; });
+	map.lazy_insert(std::string_view("b"), [] { return 2; });
+	return *containers::lookup(map, std::string_view("b")) == 2;
+}());
@@ -0,0 +1,112 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module containers.test.soa_vector;
+
+import containers.algorithms.compare;
+
+import containers.array;
+import containers.begin_end;
+import containers.size;
+import containers.soa_vector;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+import tv;
+
+using namespace bounded::literal;
+
+using soa = containers::soa_vector<int, bounded_test::integer, bool>;
+
+static_assert(bounded::convertible_to<soa::iterator, soa::const_iterator>);
+static_assert(std::same_as<decltype(*containers::begin(bounded::declval<soa &>())), tv::tuple<int &, bounded_test::integer &, bool &>>);
+
+constexpr auto make_rows(int const count) -> soa {
+	auto result = soa();
+	for (int n = 0; n != count; ++n) {
+		result.push_back(tv::tuple(n, bounded_test::integer(n * 10), n % 2 == 0));
+	}
+	return result;
+}
+
+constexpr auto test_push_back_and_columns() -> bool {
+	auto const v = make_rows(20);
+	BOUNDED_ASSERT(containers::size(v) == 20_bi);
+	BOUNDED_ASSERT(v.capacity() >= 20_bi);
+	BOUNDED_ASSERT(containers::size(v.column<0>()) == 20_bi);
+	for (int n = 0; n != 20; ++n) {
+		auto const index = bounded::assume_in_range<soa::size_type>(n);
+		BOUNDED_ASSERT(v.column<0>()[index] == n);
+		BOUNDED_ASSERT(v.column<1>()[index] == n * 10);
+		BOUNDED_ASSERT(v.column<2>()[index] == (n % 2 == 0));
+	}
+	return true;
+}
+static_assert(test_push_back_and_columns());
+
+constexpr auto test_rows() -> bool {
+	auto v = make_rows(5);
+	int expected = 0;
+	for (auto const row : v) {
+		BOUNDED_ASSERT(row[0_bi] == expected);
+		BOUNDED_ASSERT(row[1_bi] == expected * 10);
+		++expected;
+	}
+	BOUNDED_ASSERT(expected == 5);
+	v[2_bi][1_bi] = bounded_test::integer(7);
+	BOUNDED_ASSERT(v.column<1>()[2_bi] == 7);
+	auto const [number, integer, flag] = v[3_bi];
+	BOUNDED_ASSERT(number == 3);
+	BOUNDED_ASSERT(integer == 30);
+	BOUNDED_ASSERT(!flag);
+	return true;
+}
+static_assert(test_rows());
+
+constexpr auto test_push_back_own_row_at_capacity() -> bool {
+	auto v = make_rows(1);
+	while (containers::size(v) != v.capacity()) {
+		v.push_back(tv::tuple(0, bounded_test::integer(0), false));
+	}
+	v.push_back(v[0_bi]);
+	auto const [number, integer, flag] = v[bounded::assume_in_range<soa::size_type>(containers::size(v) - 1_bi)];
+	BOUNDED_ASSERT(number == 0);
+	BOUNDED_ASSERT(integer == 0);
+	BOUNDED_ASSERT(flag);
+	return true;
+}
+static_assert(test_push_back_own_row_at_capacity());
+
+constexpr auto test_copy_move_and_compare() -> bool {
+	auto const original = make_rows(10);
+	auto copy = original;
+	BOUNDED_ASSERT(copy == original);
+	copy.pop_back();
+	BOUNDED_ASSERT(containers::size(copy) == 9_bi);
+	BOUNDED_ASSERT(copy != original);
+	auto moved = std::move(copy);
+	BOUNDED_ASSERT(containers::size(moved) == 9_bi);
+	BOUNDED_ASSERT(containers::size(copy) == 0_bi);
+	moved.clear();
+	BOUNDED_ASSERT(containers::size(moved) == 0_bi);
+	return true;
+}
+static_assert(test_copy_move_and_compare());
+
+constexpr auto test_range_constructor() -> bool {
+	auto const v = containers::soa_vector<int, bool>(containers::array{
+		tv::tuple(1, true),
+		tv::tuple(2, false)
+	});
+	BOUNDED_ASSERT(containers::equal(v.column<0>(), containers::array{1, 2}));
+	BOUNDED_ASSERT(containers::equal(v.column<1>(), containers::array{true, false}));
+	return true;
+}
+static_assert(test_range_constructor());
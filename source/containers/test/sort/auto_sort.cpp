@@ -0,0 +1,76 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module containers.test.sort.auto_sort;
+
+import containers.test.sort.sort_test_data;
+import containers.test.sort.test_sort;
+
+import containers.algorithms.sort.auto_sort;
+import containers.algorithms.sort.is_sorted;
+import containers.algorithms.sort.sort;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.algorithms.generate;
+import containers.array;
+import containers.repeat_n;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+using namespace containers_test;
+
+static_assert(test_sort(uint8_1, containers::auto_sort));
+static_assert(test_sort(uint8_2, containers::auto_sort));
+static_assert(test_sort(uint8_3, containers::auto_sort));
+static_assert(test_sort(containers::array{uint8_many}, containers::auto_sort));
+static_assert(test_sort(containers::array{uint8_256}, containers::auto_sort));
+static_assert(test_sort(containers::array{uint16_many}, containers::auto_sort));
+static_assert(test_sort(containers::array{uint32_many}, containers::auto_sort));
+static_assert(test_sort(containers::array{uint64_many}, containers::auto_sort));
+static_assert(test_sort(containers::array{tuple_many}, containers::auto_sort));
+
+// Large enough to use a radix sort
+template<typename T>
+constexpr auto random_data() {
+	auto state = 1U;
+	return containers::vector<T>(containers::generate_n(1000_bi, [&] {
+		state = state * 1'103'515'245U + 12'345U;
+		return static_cast<T>(state >> 8U);
+	}));
+}
+
+template<typename T>
+constexpr auto test_large(auto... args) -> bool {
+	auto data = random_data<T>();
+	auto expected = data;
+	containers::sort(expected);
+	containers::auto_sort(data, args...);
+	return data == expected;
+}
+
+static_assert(test_large<std::uint8_t>());
+static_assert(test_large<std::int8_t>());
+static_assert(test_large<std::uint16_t>());
+static_assert(test_large<std::uint32_t>());
+static_assert(test_large<std::int64_t>());
+
+static_assert(test_large<std::uint32_t>(containers::to_radix_sort_key, containers::vector<std::uint32_t>(containers::repeat_default_n<std::uint32_t>(1000_bi))));
+static_assert(test_large<std::uint32_t>(containers::to_radix_sort_key, containers::vector<std::uint32_t>()));
+
+static_assert([] {
+	auto data = random_data<std::uint16_t>();
+	containers::auto_sort(data, std::greater());
+	return containers::is_sorted(data, std::greater());
+}());
+
+static_assert([] {
+	auto data = random_data<std::uint16_t>();
+	containers::sort(data);
+	containers::auto_sort(data);
+	return containers::is_sorted(data);
+}());
@@ -0,0 +1,123 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module containers.test.sort.external_sort;
+
+import containers.algorithms.sort.external_sort;
+import containers.algorithms.sort.sort;
+import containers.algorithms.sort.to_radix_sort_key;
+
+import containers.algorithms.generate;
+import containers.data;
+import containers.push_back;
+import containers.size;
+import containers.vector;
+
+import bounded;
+import std_module;
+
+using namespace bounded::literal;
+
+namespace {
+
+using file = std::unique_ptr<std::FILE, decltype([](std::FILE * const f) { std::fclose(f); })>;
+
+auto random_records() {
+	auto engine = std::mt19937(std::random_device()());
+	auto distribution = std::uniform_int_distribution<std::uint32_t>();
+	return containers::vector<std::uint32_t>(containers::generate_n(10'000_bi, [&] { return distribution(engine); }));
+}
+
+auto write_input(containers::vector<std::uint32_t> const & records) -> file {
+	auto input = file(std::tmpfile());
+	REQUIRE(input);
+	auto const size = static_cast<std::size_t>(containers::size(records));
+	REQUIRE(std::fwrite(containers::data(records), sizeof(std::uint32_t), size, input.get()) == size);
+	std::rewind(input.get());
+	return input;
+}
+
+auto read_output(std::FILE * const output) -> containers::vector<std::uint32_t> {
+	std::rewind(output);
+	auto result = containers::vector<std::uint32_t>();
+	auto value = std::uint32_t();
+	while (std::fread(&value, sizeof(value), 1, output) == 1) {
+		containers::push_back(result, value);
+	}
+	return result;
+}
+
+auto check_external_sort(containers::external_sort_options const options) -> void {
+	auto const records = random_records();
+	auto const input = write_input(records);
+	auto const output = file(std::tmpfile());
+	REQUIRE(output);
+	containers::external_sort<std::uint32_t>(input.get(), output.get(), containers::to_radix_sort_key, options);
+	auto expected = records;
+	containers::sort(expected);
+	CHECK(read_output(output.get()) == expected);
+}
+
+} // namespace
+
+TEST_CASE("external_sort fits in memory") {
+	check_external_sort(containers::external_sort_options());
+}
+
+TEST_CASE("external_sort single merge pass") {
+	check_external_sort(containers::external_sort_options{
+		.memory_budget = 8 * 1024,
+		.io_block_size = 256,
+	});
+}
+
+TEST_CASE("external_sort multiple merge passes") {
+	// Runs of 64 records, merged at most three at a time
+	check_external_sort(containers::external_sort_options{
+		.memory_budget = 512,
+		.io_block_size = 128,
+	});
+}
+
+TEST_CASE("external_sort budget smaller than three blocks") {
+	auto const input = write_input(random_records());
+	auto const output = file(std::tmpfile());
+	REQUIRE(output);
+	auto const options = containers::external_sort_options{
+		.memory_budget = 1024,
+		.io_block_size = 512,
+	};
+	CHECK_THROWS_AS(
+		containers::external_sort<std::uint32_t>(input.get(), output.get(), containers::to_radix_sort_key, options),
+		std::invalid_argument
+	);
+}
+
+TEST_CASE("external_sort partial record") {
+	auto const input = write_input(random_records());
+	REQUIRE(std::fseek(input.get(), 0, SEEK_END) == 0);
+	auto const partial = std::array<unsigned char, 2>({1, 2});
+	REQUIRE(std::fwrite(partial.data(), 1, partial.size(), input.get()) == partial.size());
+	std::rewind(input.get());
+	auto const output = file(std::tmpfile());
+	REQUIRE(output);
+	CHECK_THROWS_AS(
+		containers::external_sort<std::uint32_t>(input.get(), output.get()),
+		std::runtime_error
+	);
+}
+
+TEST_CASE("external_sort empty input") {
+	auto const input = file(std::tmpfile());
+	auto const output = file(std::tmpfile());
+	REQUIRE(input);
+	REQUIRE(output);
+	containers::external_sort<std::uint32_t>(input.get(), output.get());
+	CHECK(read_output(output.get()) == containers::vector<std::uint32_t>());
+}
@@ -6,6 +6,7 @@
 #include <benchmark/benchmark.h>
 
 import containers.algorithms.sort.inplace_radix_sort;
+import containers.test.sort.sort_benchmark_statistics;
 
 import bounded;
 import containers;
@@ -207,7 +208,11 @@ BENCHMARK(benchmark_limited_inplace_sort)->LIMITED_RANGE();
 	do { \
 		benchmark::RegisterBenchmark( \
 			name, \
-			[](auto & state) { runner(state, create); } \
+			[](auto & state) { \
+				containers::reset_sort_statistics(); \
+				runner(state, create); \
+				containers_test::add_sort_statistics(state); \
+			} \
 		)->RangeMultiplier(profile_multiplier)->Range(profile_multiplier, max_profile_range); \
 	} while (false)
 
@@ -21,6 +21,11 @@ static_assert(test_sort(uint8_1, containers::sort));
 static_assert(test_sort(uint8_2, containers::sort));
 static_assert(test_sort(uint8_3, containers::sort));
 
+static_assert(test_sort(uint8_1, containers::new_sort));
+static_assert(test_sort(uint8_2, containers::new_sort));
+static_assert(test_sort(uint8_3, containers::new_sort));
+static_assert(test_sort(containers::array{uint8_256}, containers::new_sort));
+
 static_assert(test_sort(
 	containers::array{
 		sort_test_data(
@@ -7,6 +7,7 @@
 #include <bounded/assert.hpp>
 
 import containers.algorithms.sort.chunked_insertion_sort;
+import containers.test.sort.sort_benchmark_statistics;
 
 import bounded;
 import containers;
@@ -39,6 +40,7 @@ auto benchmark_sort(benchmark::State & state) -> void {
 	auto const size = bounded::assume_in_range<size_type>(state.range(0));
 	auto container = container_t(containers::repeat_default_n<data<data_size>>(size));
 
+	containers::reset_sort_statistics();
 	for (auto _ : state) {
 		containers::copy(
 			containers::generate_n(
@@ -54,6 +56,7 @@ auto benchmark_sort(benchmark::State & state) -> void {
 		benchmark::DoNotOptimize(container);
 		benchmark::ClobberMemory();
 	}
+	containers_test::add_sort_statistics(state);
 }
 
 
@@ -0,0 +1,29 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <benchmark/benchmark.h>
+
+export module containers.test.sort.sort_benchmark_statistics;
+
+import containers.algorithms.sort.sort_statistics;
+
+import std_module;
+
+namespace containers_test {
+
+// Build with CONTAINERS_SORT_STATISTICS to report these. The values are per
+// iteration, so `--benchmark_format=json` gives the data needed to tune the
+// thresholds in the sorting algorithms.
+export auto add_sort_statistics(benchmark::State & state) -> void {
+	if constexpr (containers::sort_statistics_enabled) {
+		containers::for_each_sort_statistic(containers::reset_sort_statistics(), [&](auto const & name, std::size_t const value) {
+			state.counters[std::string(name)] = benchmark::Counter(static_cast<double>(value), benchmark::Counter::kAvgIterations);
+		});
+	}
+}
+
+} // namespace containers_test
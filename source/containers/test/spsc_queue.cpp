@@ -0,0 +1,72 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <doctest/doctest.h>
+
+import containers.algorithms.compare;
+import containers.array;
+import containers.begin_end;
+import containers.size;
+import containers.spsc_queue;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+
+using namespace bounded::literal;
+
+TEST_CASE("spsc_queue push and pop") {
+	auto queue = containers::static_spsc_queue<bounded_test::integer, 4_bi>();
+	CHECK(queue.capacity() == 4);
+	CHECK(!queue.try_pop());
+	CHECK(queue.try_push(bounded_test::integer(1)));
+	CHECK(queue.try_push(bounded_test::integer(2)));
+	CHECK(queue.try_push(bounded_test::integer(3)));
+	CHECK(queue.try_push(bounded_test::integer(4)));
+	CHECK(!queue.try_push(bounded_test::integer(5)));
+	CHECK(*queue.try_pop() == 1);
+	CHECK(queue.try_push(bounded_test::integer(5)));
+	CHECK(*queue.try_pop() == 2);
+	CHECK(*queue.try_pop() == 3);
+	CHECK(*queue.try_pop() == 4);
+	CHECK(*queue.try_pop() == 5);
+	CHECK(!queue.try_pop());
+}
+
+TEST_CASE("spsc_queue ranges") {
+	auto queue = containers::spsc_queue<int>(5_bi);
+	CHECK(queue.capacity() == 8);
+	auto const source = containers::array{1, 2, 3, 4, 5, 6};
+	CHECK(containers::size(queue.push_range(source)) == 0_bi);
+	CHECK(containers::equal(queue.front_range(), source));
+	queue.pop_front_n(4);
+	// Wraps around the end of the storage
+	auto const more = containers::array{7, 8, 9, 10, 11, 12, 13};
+	auto const rest = queue.push_range(more);
+	CHECK(containers::equal(rest, containers::array{13}));
+	CHECK(containers::equal(queue.front_range(), containers::array{5, 6, 7, 8}));
+	queue.pop_front_n(4);
+	CHECK(containers::equal(queue.front_range(), containers::array{9, 10, 11, 12}));
+}
+
+TEST_CASE("spsc_queue between threads") {
+	constexpr auto count = 100'000;
+	auto queue = containers::static_spsc_queue<int, 64_bi>();
+	auto producer = std::thread([&] {
+		for (int n = 0; n != count; ++n) {
+			while (!queue.try_push(n)) {
+			}
+		}
+	});
+	auto expected = 0;
+	while (expected != count) {
+		if (auto const value = queue.try_pop()) {
+			CHECK(*value == expected);
+			++expected;
+		}
+	}
+	producer.join();
+	CHECK(!queue.try_pop());
+}
@@ -0,0 +1,160 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+
+#if defined __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+import bounded;
+import containers;
+import std_module;
+
+namespace {
+
+using namespace bounded::literal;
+
+// Without pinning, the scheduler can put both threads on the same core, which
+// measures context switches rather than the queue. The benchmark library runs
+// every benchmark on the main thread, so the original affinity is restored at
+// the end of the scope.
+struct scoped_thread_pin {
+	explicit scoped_thread_pin(unsigned const core) {
+#if defined __linux__
+		pthread_getaffinity_np(pthread_self(), sizeof(m_original), &m_original);
+		auto cpus = cpu_set_t();
+		CPU_ZERO(&cpus);
+		CPU_SET(core % std::max(std::thread::hardware_concurrency(), 1U), &cpus);
+		pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#else
+		static_cast<void>(core);
+#endif
+	}
+	scoped_thread_pin(scoped_thread_pin const &) = delete;
+	auto operator=(scoped_thread_pin const &) -> scoped_thread_pin & = delete;
+	~scoped_thread_pin() {
+#if defined __linux__
+		pthread_setaffinity_np(pthread_self(), sizeof(m_original), &m_original);
+#endif
+	}
+
+private:
+#if defined __linux__
+	cpu_set_t m_original = {};
+#endif
+};
+
+constexpr auto messages_per_iteration = 1 << 16;
+
+using queue_t = containers::static_spsc_queue<std::uint64_t, 1024_bi>;
+
+// One thread pushes as fast as it can and another pops as fast as it can
+auto benchmark_throughput(benchmark::State & state) -> void {
+	auto queue = queue_t();
+	auto running = std::atomic<bool>(true);
+	auto consumer = std::thread([&] {
+		auto const pin = scoped_thread_pin(1);
+		auto total = std::uint64_t(0);
+		while (running.load(std::memory_order_relaxed)) {
+			if (auto const value = queue.try_pop()) {
+				total += *value;
+			}
+		}
+		while (auto const value = queue.try_pop()) {
+			total += *value;
+		}
+		benchmark::DoNotOptimize(total);
+	});
+	auto const pin = scoped_thread_pin(0);
+	for (auto _ : state) {
+		for (std::uint64_t n = 0; n != messages_per_iteration; ++n) {
+			while (!queue.try_push(n)) {
+			}
+		}
+	}
+	running.store(false, std::memory_order_relaxed);
+	consumer.join();
+	state.SetItemsProcessed(state.iterations() * messages_per_iteration);
+}
+
+// The same, but each side moves as many elements as it can at once
+auto benchmark_throughput_ranges(benchmark::State & state) -> void {
+	auto queue = queue_t();
+	auto running = std::atomic<bool>(true);
+	auto consumer = std::thread([&] {
+		auto const pin = scoped_thread_pin(1);
+		auto total = std::uint64_t(0);
+		auto consume = [&] {
+			auto const elements = queue.front_range();
+			for (auto const value : elements) {
+				total += value;
+			}
+			queue.pop_front_n(static_cast<std::size_t>(containers::size(elements)));
+			return !containers::is_empty(elements);
+		};
+		while (running.load(std::memory_order_relaxed)) {
+			consume();
+		}
+		while (consume()) {
+		}
+		benchmark::DoNotOptimize(total);
+	});
+	auto const pin = scoped_thread_pin(0);
+	auto batch = containers::array<std::uint64_t, 64_bi>();
+	for (std::uint64_t n = 0; auto & value : batch) {
+		value = n;
+		++n;
+	}
+	for (auto _ : state) {
+		for (auto n = 0; n != messages_per_iteration / 64; ++n) {
+			auto remaining = containers::subrange(containers::begin(batch), containers::end(batch));
+			while (!containers::is_empty(remaining)) {
+				remaining = queue.push_range(remaining);
+			}
+		}
+	}
+	running.store(false, std::memory_order_relaxed);
+	consumer.join();
+	state.SetItemsProcessed(state.iterations() * messages_per_iteration);
+}
+
+// Sends a message and waits for the reply, so each iteration is one round
+// trip between the two cores
+auto benchmark_round_trip_latency(benchmark::State & state) -> void {
+	auto requests = queue_t();
+	auto replies = queue_t();
+	auto echo = std::thread([&] {
+		auto const pin = scoped_thread_pin(1);
+		while (true) {
+			if (auto const value = requests.try_pop()) {
+				if (*value == 0) {
+					return;
+				}
+				while (!replies.try_push(*value)) {
+				}
+			}
+		}
+	});
+	auto const pin = scoped_thread_pin(0);
+	auto message = std::uint64_t(1);
+	for (auto _ : state) {
+		while (!requests.try_push(message)) {
+		}
+		while (!replies.try_pop()) {
+		}
+		++message;
+	}
+	while (!requests.try_push(0)) {
+	}
+	echo.join();
+}
+
+BENCHMARK(benchmark_throughput)->UseRealTime();
+BENCHMARK(benchmark_throughput_ranges)->UseRealTime();
+BENCHMARK(benchmark_round_trip_latency)->UseRealTime();
+
+} // namespace
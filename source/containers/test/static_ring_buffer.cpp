@@ -0,0 +1,109 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <bounded/assert.hpp>
+#include <doctest/doctest.h>
+
+import containers.test.test_sequence_container;
+
+import containers.algorithms.compare;
+import containers.array;
+import containers.back;
+import containers.begin_end;
+import containers.front;
+import containers.lazy_push_front;
+import containers.pop_back;
+import containers.pop_front;
+import containers.push_back;
+import containers.push_back_into_capacity;
+import containers.push_front;
+import containers.size;
+import containers.static_ring_buffer;
+
+import bounded;
+import bounded.test_int;
+import std_module;
+
+using namespace bounded::literal;
+
+template<typename T>
+using test_ring_buffer = containers::static_ring_buffer<T, 40_bi>;
+
+static_assert(test_ring_buffer<int>::capacity() == 40_bi);
+static_assert(bounded::trivially_copy_constructible<test_ring_buffer<int>>);
+static_assert(!bounded::trivially_copy_constructible<test_ring_buffer<bounded_test::integer>>);
+
+static_assert(bounded::default_constructible<test_ring_buffer<int>>);
+static_assert(containers_test::test_sequence_container<test_ring_buffer<int>>());
+
+// Pushes and pops enough that the elements wrap around the end of the storage
+template<auto capacity>
+constexpr auto test_wrap_around() -> bool {
+	auto buffer = containers::static_ring_buffer<int, capacity>();
+	int next_pushed = 0;
+	int next_popped = 0;
+	for (int round = 0; round != 10; ++round) {
+		while (containers::size(buffer) != capacity) {
+			containers::push_back_into_capacity(buffer, next_pushed);
+			++next_pushed;
+		}
+		BOUNDED_ASSERT(buffer.head() == buffer.tail());
+		for (int n = 0; n != 3; ++n) {
+			BOUNDED_ASSERT(containers::front(buffer) == next_popped);
+			containers::pop_front(buffer);
+			++next_popped;
+		}
+	}
+	auto expected = next_popped;
+	for (auto const value : buffer) {
+		BOUNDED_ASSERT(value == expected);
+		++expected;
+	}
+	BOUNDED_ASSERT(expected == next_pushed);
+	return true;
+}
+static_assert(test_wrap_around<8_bi>());
+static_assert(test_wrap_around<7_bi>());
+
+constexpr auto test_both_ends() -> bool {
+	auto buffer = containers::static_ring_buffer<int, 5_bi>();
+	containers::push_back(buffer, 1);
+	containers::push_front(buffer, 0);
+	containers::push_back(buffer, 2);
+	containers::push_front(buffer, -1);
+	BOUNDED_ASSERT(containers::equal(buffer, containers::array{-1, 0, 1, 2}));
+	BOUNDED_ASSERT(buffer[1_bi] == 0);
+	containers::pop_back(buffer);
+	BOUNDED_ASSERT(containers::back(buffer) == 1);
+	return true;
+}
+static_assert(test_both_ends());
+
+constexpr auto test_spans_and_bulk() -> bool {
+	auto buffer = containers::static_ring_buffer<int, 8_bi>();
+	buffer.append(containers::array{0, 1, 2, 3, 4, 5});
+	buffer.pop_front_n(4_bi);
+	BOUNDED_ASSERT(buffer.head() == 4_bi);
+	// Fills the two slots at the end of the storage and two at the start
+	buffer.append(containers::array{6, 7, 8, 9});
+	BOUNDED_ASSERT(containers::equal(buffer, containers::array{4, 5, 6, 7, 8, 9}));
+	auto const spans = buffer.spans();
+	BOUNDED_ASSERT(containers::equal(spans[0_bi], containers::array{4, 5, 6, 7}));
+	BOUNDED_ASSERT(containers::equal(spans[1_bi], containers::array{8, 9}));
+	buffer.pop_front_n(5_bi);
+	BOUNDED_ASSERT(containers::equal(buffer.spans()[0_bi], containers::array{9}));
+	BOUNDED_ASSERT(containers::size(buffer.spans()[1_bi]) == 0_bi);
+	return true;
+}
+static_assert(test_spans_and_bulk());
+
+TEST_CASE("static_ring_buffer") {
+	static_assert(bounded::default_constructible<test_ring_buffer<bounded_test::integer>>);
+	containers_test::test_sequence_container<test_ring_buffer<bounded_test::integer>>();
+	auto buffer = test_ring_buffer<bounded_test::non_copyable_integer>();
+	containers::lazy_push_front(buffer, bounded::value_to_function(3));
+	containers::lazy_push_front(buffer, bounded::value_to_function(4));
+	CHECK(buffer == test_ring_buffer<bounded_test::non_copyable_integer>({4, 3}));
+}